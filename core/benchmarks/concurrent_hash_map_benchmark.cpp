@@ -0,0 +1,118 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#include <binary_tree.hpp>
+#include <concurrent_hash_map.hpp>
+#include <lock.hpp>
+
+using namespace Rong;
+
+static constexpr const Size OPERATION_COUNT = 400000;
+static constexpr const U KEY_RANGE = 1 << 16;
+
+/// The setup this map replaces: one tree behind one mutex.
+class LockedTree
+{
+private:
+    Mutex lock;
+    BinaryTree<U, U> tree;
+
+public:
+    auto set(U p_key, U p_value) -> void
+    {
+        auto guard = MutexGuard(lock);
+        tree.set(p_key, p_value);
+    }
+
+    auto find(U p_key, U &p_value) -> B
+    {
+        auto guard = MutexGuard(lock);
+        const auto found = tree.find(p_key);
+        if (found == nullptr)
+            return false;
+        p_value = *found;
+        return true;
+    }
+};
+
+template <class T>
+struct Worker
+{
+    T *table;
+    U seed;
+    U read_percent;
+    Size operations;
+    U checksum;
+};
+
+template <class T>
+static auto work(void *p_worker) -> void *
+{
+    auto worker = static_cast<Worker<T> *>(p_worker);
+    auto state = worker->seed;
+    for (Size i = 0; i < worker->operations; i++)
+    {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        const auto key = state % KEY_RANGE;
+        U value = 0;
+        if (state / KEY_RANGE % 100 < worker->read_percent)
+            worker->checksum += worker->table->find(key, value) ? value : 0;
+        else
+            worker->table->set(key, i);
+    }
+    return nullptr;
+}
+
+/// Runs `OPERATION_COUNT` operations split over `p_thread_count` threads and returns millions of operations per second.
+template <class T>
+static auto run(T &p_table, U p_thread_count, U p_read_percent) -> F64
+{
+    // Half the key range, in scrambled order so that the tree does not degenerate into a list.
+    for (U i = 0; i < KEY_RANGE / 2; i++)
+        p_table.set(i * 40503u % KEY_RANGE, i);
+
+    auto threads = static_cast<pthread_t *>(calloc(p_thread_count, sizeof(pthread_t)));
+    auto workers = static_cast<Worker<T> *>(calloc(p_thread_count, sizeof(Worker<T>)));
+    timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (U i = 0; i < p_thread_count; i++)
+    {
+        workers[i] = {&p_table, 0x9E3779B9u * (i + 1), p_read_percent, OPERATION_COUNT / p_thread_count, 0};
+        pthread_create(threads + i, nullptr, work<T>, workers + i);
+    }
+    for (U i = 0; i < p_thread_count; i++)
+        pthread_join(threads[i], nullptr);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    free(threads);
+    free(workers);
+
+    const auto seconds = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) * 1e-9;
+    return OPERATION_COUNT / seconds / 1e6;
+}
+
+auto main(I p_argc, C **p_argv) -> I
+{
+    const auto max_thread_count = p_argc > 1 ? static_cast<U>(atoi(p_argv[1])) : static_cast<U>(sysconf(_SC_NPROCESSORS_ONLN));
+    const U read_percents[] = {50, 90, 99};
+
+    printf("%8s %8s %16s %16s\n", "threads", "reads%", "locked tree", "sharded map");
+    for (U thread_count = 1; thread_count <= max_thread_count; thread_count *= 2)
+    {
+        for (auto read_percent : read_percents)
+        {
+            auto tree = new LockedTree();
+            auto map = new ConcurrentHashMap<U, U>();
+            const auto tree_rate = run(*tree, thread_count, read_percent);
+            const auto map_rate = run(*map, thread_count, read_percent);
+            delete tree;
+            delete map;
+            printf("%8u %8u %13.2f M/s %13.2f M/s\n", thread_count, read_percent, tree_rate, map_rate);
+        }
+    }
+    return 0;
+}
\ No newline at end of file
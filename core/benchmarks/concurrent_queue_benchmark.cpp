@@ -0,0 +1,139 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sched.h>
+
+#include <concurrent_queue.hpp>
+#include <list.hpp>
+#include <lock.hpp>
+
+using namespace Rong;
+
+static constexpr const U ELEMENT_COUNT = 1 << 18;
+static constexpr const Size QUEUE_CAPACITY = 1024;
+
+/// The setup this queue replaces: a `List` behind a mutex.
+class LockedList
+{
+private:
+    Mutex lock;
+    List<U> list;
+
+public:
+    auto enqueue_many(const ListView<U> &p_values) -> Size
+    {
+        auto guard = MutexGuard(lock);
+        if (list.get_count() >= QUEUE_CAPACITY)
+            return 0;
+        const auto data = p_values.view_data();
+        for (Size i = 0; i < p_values.get_count(); i++)
+            list.append(data[i]);
+        return p_values.get_count();
+    }
+
+    auto dequeue_many(List<U> &p_values, Size p_max_count) -> Size
+    {
+        auto guard = MutexGuard(lock);
+        Size count = 0;
+        while (count < p_max_count && list.get_count() != 0)
+        {
+            p_values.append(list.pop_front());
+            count++;
+        }
+        return count;
+    }
+};
+
+template <class T>
+struct Endpoint
+{
+    T *queue;
+    U count;
+    U batch;
+    U64 sum;
+};
+
+template <class T>
+static auto produce(void *p_endpoint) -> void *
+{
+    auto endpoint = static_cast<Endpoint<T> *>(p_endpoint);
+    auto values = List<U>();
+    for (U i = 0; i < endpoint->batch; i++)
+        values.append(i);
+
+    for (U sent = 0; sent < endpoint->count;)
+    {
+        const auto remaining = endpoint->count - sent;
+        const auto count = endpoint->queue->enqueue_many(ListView<U>(values.view_data(), remaining < endpoint->batch ? remaining : endpoint->batch));
+        sent += count;
+        if (count == 0)
+            sched_yield();
+    }
+    return nullptr;
+}
+
+template <class T>
+static auto consume(void *p_endpoint) -> void *
+{
+    auto endpoint = static_cast<Endpoint<T> *>(p_endpoint);
+    auto values = List<U>(endpoint->batch);
+    for (U received = 0; received < endpoint->count;)
+    {
+        values.clean();
+        const auto remaining = endpoint->count - received;
+        const auto count = endpoint->queue->dequeue_many(values, remaining < endpoint->batch ? remaining : endpoint->batch);
+        for (Size i = 0; i < count; i++)
+            endpoint->sum += values[i];
+        received += count;
+        if (count == 0)
+            sched_yield();
+    }
+    return nullptr;
+}
+
+/// Moves `ELEMENT_COUNT` elements through `p_queue` and returns millions of elements per second.
+template <class T>
+static auto run(T &p_queue, U p_thread_count, U p_batch) -> F64
+{
+    auto threads = static_cast<pthread_t *>(calloc(p_thread_count * 2, sizeof(pthread_t)));
+    auto endpoints = static_cast<Endpoint<T> *>(calloc(p_thread_count * 2, sizeof(Endpoint<T>)));
+    timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (U i = 0; i < p_thread_count * 2; i++)
+    {
+        endpoints[i] = {&p_queue, ELEMENT_COUNT / p_thread_count, p_batch, 0};
+        pthread_create(threads + i, nullptr, i < p_thread_count ? produce<T> : consume<T>, endpoints + i);
+    }
+    for (U i = 0; i < p_thread_count * 2; i++)
+        pthread_join(threads[i], nullptr);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    free(threads);
+    free(endpoints);
+
+    const auto seconds = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) * 1e-9;
+    return ELEMENT_COUNT / seconds / 1e6;
+}
+
+auto main(I p_argc, C **p_argv) -> I
+{
+    const auto max_thread_count = p_argc > 1 ? static_cast<U>(atoi(p_argv[1])) : static_cast<U>(sysconf(_SC_NPROCESSORS_ONLN) + 1) / 2;
+    const U batches[] = {1, 32};
+
+    printf("%10s %8s %16s %16s\n", "producers", "batch", "locked list", "queue");
+    for (U thread_count = 1; thread_count <= max_thread_count; thread_count *= 2)
+    {
+        for (auto batch : batches)
+        {
+            auto list = new LockedList();
+            auto queue = new ConcurrentQueue<U>(QUEUE_CAPACITY);
+            const auto list_rate = run(*list, thread_count, batch);
+            const auto queue_rate = run(*queue, thread_count, batch);
+            delete list;
+            delete queue;
+            printf("%10u %8u %13.2f M/s %13.2f M/s\n", thread_count, batch, list_rate, queue_rate);
+        }
+    }
+    return 0;
+}
\ No newline at end of file
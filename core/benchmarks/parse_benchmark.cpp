@@ -0,0 +1,89 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <list.hpp>
+#include <parse.hpp>
+
+using namespace Rong;
+
+static constexpr const Size VALUE_COUNT = 1 << 20;
+
+static auto now() -> F64
+{
+    timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec + time.tv_nsec * 1e-9;
+}
+
+static auto build_text(const C *p_format, B p_floating) -> List<C>
+{
+    auto text = List<C>(VALUE_COUNT * 24);
+    U64 state = 7;
+    for (Size i = 0; i < VALUE_COUNT; i++)
+    {
+        state = state * 6364136223846793005 + 1442695040888963407;
+        C field[64];
+        const auto length = p_floating ? snprintf(field, sizeof(field), p_format, static_cast<F64>(state >> 20) * 1e-6)
+                                       : snprintf(field, sizeof(field), p_format, static_cast<long long>(state >> 2));
+        for (I j = 0; j < length; j++)
+            text.append(field[j]);
+        text.append('\n');
+    }
+    return text;
+}
+
+/// The loop this replaces: null-terminated C library conversions field by field.
+template <class T, class F>
+static auto parse_with_library(const List<C> &p_text, List<T> &p_values, const F &p_convert) -> void
+{
+    const auto data = p_text.view_data();
+    const auto end = data + p_text.get_count();
+    auto cursor = data;
+    while (cursor < end)
+    {
+        C *field_end = nullptr;
+        p_values.append(p_convert(cursor, &field_end));
+        cursor = field_end + 1;
+    }
+}
+
+template <class F>
+static auto measure(const List<C> &p_text, const F &p_parse) -> F64
+{
+    const auto start = now();
+    p_parse();
+    return p_text.get_count() / (now() - start) / 1e9;
+}
+
+auto main() -> int
+{
+    printf("%10s %16s %16s\n", "input", "C library", "bulk parser");
+
+    const auto integers = build_text("%lld", false);
+    auto library_integers = List<I64>(VALUE_COUNT);
+    auto parsed_integers = List<I64>(VALUE_COUNT);
+    const auto integer_library_rate = measure(integers, [&]()
+                                              { parse_with_library(integers, library_integers, [](const C *p_text, C **p_end)
+                                                                   { return static_cast<I64>(strtoll(p_text, p_end, 10)); }); });
+    const auto integer_rate = measure(integers, [&]()
+                                      { parse_integers(integers, '\n', parsed_integers); });
+    printf("%10s %11.2f GB/s %11.2f GB/s\n", "integers", integer_library_rate, integer_rate);
+
+    const auto floats = build_text("%.6f", true);
+    auto library_floats = List<F64>(VALUE_COUNT);
+    auto parsed_floats = List<F64>(VALUE_COUNT);
+    const auto float_library_rate = measure(floats, [&]()
+                                            { parse_with_library(floats, library_floats, [](const C *p_text, C **p_end)
+                                                                 { return strtod(p_text, p_end); }); });
+    const auto float_rate = measure(floats, [&]()
+                                    { parse_floats(floats, '\n', parsed_floats); });
+    printf("%10s %11.2f GB/s %11.2f GB/s\n", "floats", float_library_rate, float_rate);
+
+    B identical = library_integers == parsed_integers && library_floats.get_count() == parsed_floats.get_count();
+    for (Size i = 0; identical && i < parsed_floats.get_count(); i++)
+        identical = library_floats[i] == parsed_floats[i];
+    if (!identical)
+        printf("results differ\n");
+    return 0;
+}
\ No newline at end of file
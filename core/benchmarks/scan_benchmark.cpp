@@ -0,0 +1,66 @@
+#include <stdio.h>
+#include <time.h>
+
+#include <list.hpp>
+#include <scan.hpp>
+
+using namespace Rong;
+
+static constexpr const Size TEXT_SIZE = 1 << 24;
+static constexpr const U ROUND_COUNT = 8;
+
+static auto now() -> F64
+{
+    timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec + time.tv_nsec * 1e-9;
+}
+
+/// The loop this replaces: one bounds-checked `ListIterator` step per byte.
+static auto split_by_iterator(const ListView<C> &p_text, C p_delimiter) -> List<ListView<C>>
+{
+    auto fields = List<ListView<C>>();
+    Size begin = 0;
+    Size index = 0;
+    for (auto it = p_text.cbegin(); it != p_text.cend(); ++it, index++)
+    {
+        if (*it != p_delimiter)
+            continue;
+        fields.append(begin == index ? ListView<C>() : list_slice(p_text, begin, index));
+        begin = index + 1;
+    }
+    fields.append(begin == index ? ListView<C>() : list_slice(p_text, begin, index));
+    return fields;
+}
+
+template <class F>
+static auto measure(const ListView<C> &p_text, const F &p_split) -> F64
+{
+    Size field_count = 0;
+    const auto start = now();
+    for (U i = 0; i < ROUND_COUNT; i++)
+        field_count += p_split(p_text).get_count();
+    const auto seconds = now() - start;
+    if (field_count == 0)
+        printf("unreachable\n");
+    return TEXT_SIZE * ROUND_COUNT / seconds / 1e9;
+}
+
+auto main() -> int
+{
+    printf("%12s %16s %16s\n", "line length", "iterator", "split");
+    const Size line_lengths[] = {16, 80, 1024};
+    for (auto line_length : line_lengths)
+    {
+        auto text = List<C>(TEXT_SIZE);
+        for (Size i = 0; i < TEXT_SIZE; i++)
+            text.append(i % line_length == line_length - 1 ? '\n' : 'a' + i % 26);
+
+        const auto iterator_rate = measure(text, [](const ListView<C> &p_text)
+                                           { return split_by_iterator(p_text, '\n'); });
+        const auto split_rate = measure(text, [](const ListView<C> &p_text)
+                                        { return split(p_text, '\n'); });
+        printf("%12zu %11.2f GB/s %11.2f GB/s\n", static_cast<size_t>(line_length), iterator_rate, split_rate);
+    }
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,82 @@
+#include <stdio.h>
+#include <time.h>
+
+#include <iterator.hpp>
+#include <list.hpp>
+
+using namespace Rong;
+
+static constexpr const Size ELEMENT_COUNT = 1 << 22;
+static constexpr const U ROUND_COUNT = 32;
+
+static auto now() -> F64
+{
+    timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec + time.tv_nsec * 1e-9;
+}
+
+static auto dot_by_pointer(const List<F64> &p_first, const List<F64> &p_second, const List<F64> &p_third) -> F64
+{
+    const auto first = p_first.view_data();
+    const auto second = p_second.view_data();
+    const auto third = p_third.view_data();
+    F64 sum = 0;
+    for (Size i = 0; i < p_first.get_count(); i++)
+        sum += first[i] * second[i] + third[i];
+    return sum;
+}
+
+static auto dot_by_index(const List<F64> &p_first, const List<F64> &p_second, const List<F64> &p_third) -> F64
+{
+    F64 sum = 0;
+    for (Size i = 0; i < p_first.get_count(); i++)
+        sum += p_first[i] * p_second[i] + p_third[i];
+    return sum;
+}
+
+static auto dot_by_zip(const List<F64> &p_first, const List<F64> &p_second, const List<F64> &p_third) -> F64
+{
+    F64 sum = 0;
+    const auto rows = zip(p_first, p_second, p_third);
+    for (auto it = rows.cbegin(); !(it == rows.cend()); ++it)
+    {
+        const auto [first, second, third] = *it;
+        sum += first * second + third;
+    }
+    return sum;
+}
+
+template <class F>
+static auto measure(const List<F64> &p_first, const List<F64> &p_second, const List<F64> &p_third, const F &p_dot, F64 &p_result) -> F64
+{
+    p_result = 0;
+    const auto start = now();
+    for (U i = 0; i < ROUND_COUNT; i++)
+        p_result += p_dot(p_first, p_second, p_third);
+    const auto seconds = now() - start;
+    return ELEMENT_COUNT * ROUND_COUNT / seconds / 1e6;
+}
+
+auto main() -> int
+{
+    auto first = List<F64>(ELEMENT_COUNT);
+    auto second = List<F64>(ELEMENT_COUNT);
+    auto third = List<F64>(ELEMENT_COUNT);
+    for (Size i = 0; i < ELEMENT_COUNT; i++)
+    {
+        first.append(i % 7 * 0.25);
+        second.append(i % 5 * 0.5);
+        third.append(i % 3);
+    }
+
+    F64 pointer_result, index_result, zip_result;
+    const auto pointer_rate = measure(first, second, third, dot_by_pointer, pointer_result);
+    const auto index_rate = measure(first, second, third, dot_by_index, index_result);
+    const auto zip_rate = measure(first, second, third, dot_by_zip, zip_result);
+    if (pointer_result != index_result || index_result != zip_result)
+        printf("results differ\n");
+    printf("%10s %16s %16s\n", "pointer", "operator[]", "zip");
+    printf("%6.0f M/s %11.0f M/s %11.0f M/s\n", pointer_rate, index_rate, zip_rate);
+    return 0;
+}
\ No newline at end of file
@@ -1,6 +1,8 @@
 #ifndef RG_CORE_ALLOCATOR_HPP
 #define RG_CORE_ALLOCATOR_HPP
 
+#include <stddef.h>
+
 #include "def.hpp"
 #include "exception.hpp"
 
@@ -39,6 +41,127 @@ namespace Rong
     };
     static_assert(IsAllocatorFeaturesAvailable<Allocator<X>, X>, "`Allocator` is malformed.");
 
+    /// Bump region owned by one object; blocks are never freed individually, only all together when the arena is released or destroyed. Not thread-safe.
+    class Arena
+    {
+    public:
+        static constexpr const Size CHUNK_SIZE = 64 * 1024;
+
+    private:
+        struct Chunk
+        {
+            Chunk *next;
+            Size used;
+            Size capacity;
+        };
+
+        static constexpr const Size HEADER_SIZE = (sizeof(Chunk) + alignof(max_align_t) - 1) / alignof(max_align_t) * alignof(max_align_t);
+
+        Chunk *chunk;
+
+    public:
+        Arena() : chunk(nullptr) {}
+        Arena(const Arena &p_arena) = delete;
+        Arena(Arena &&p_arena) : chunk(p_arena.chunk) { p_arena.chunk = nullptr; }
+
+        ~Arena()
+        {
+            release();
+        }
+
+        auto operator=(const Arena &p_arena) -> Arena & = delete;
+        auto operator=(Arena &&p_arena) -> Arena &
+        {
+            if (this == &p_arena)
+                return *this;
+            release();
+            chunk = p_arena.chunk;
+            p_arena.chunk = nullptr;
+            return *this;
+        }
+
+        inline auto is_empty() const -> B { return chunk == nullptr; }
+
+        auto allocate(Size p_size, Size p_alignment) -> void *
+        {
+            if (chunk != nullptr)
+            {
+                const auto offset = (chunk->used + p_alignment - 1) / p_alignment * p_alignment;
+                if (offset + p_size <= chunk->capacity)
+                {
+                    chunk->used = offset + p_size;
+                    return (U8 *)chunk + HEADER_SIZE + offset;
+                }
+            }
+
+            const auto capacity = p_size > CHUNK_SIZE ? p_size : CHUNK_SIZE;
+            auto allocated = (Chunk *)calloc(1, HEADER_SIZE + capacity);
+            if (allocated == nullptr)
+                throw Exception<RUNTIME>("Fail to allocate memory.");
+            allocated->next = chunk;
+            allocated->used = p_size;
+            allocated->capacity = capacity;
+            chunk = allocated;
+            return (U8 *)allocated + HEADER_SIZE;
+        }
+
+        /// Takes over every chunk of `p_arena`, so whatever was allocated there now lives as long as this arena.
+        auto adopt(Arena &p_arena) -> void
+        {
+            if (this == &p_arena || p_arena.chunk == nullptr)
+                return;
+
+            auto last = p_arena.chunk;
+            while (last->next != nullptr)
+                last = last->next;
+            // Keeps the partially used chunk in front, so allocation continues where it left off.
+            if (chunk == nullptr)
+                chunk = p_arena.chunk;
+            else
+            {
+                last->next = chunk->next;
+                chunk->next = p_arena.chunk;
+            }
+            p_arena.chunk = nullptr;
+        }
+
+        /// The arena may itself live in one of its chunks, so only locals are touched once freeing starts.
+        auto release() -> void
+        {
+            auto current = chunk;
+            chunk = nullptr;
+            while (current != nullptr)
+            {
+                auto next = current->next;
+                free(current);
+                current = next;
+            }
+        }
+    };
+
+    /// Allocator whose blocks come from an `Arena` owned by the container; without one it falls back to the heap like `Allocator`.
+    template <class T>
+    concept IsArenaAllocator = requires(Arena &p_arena, Size p_count) {
+        {
+            T::allocate(p_arena, p_count)
+        } -> IsSame<typename T::Type *>;
+    };
+
+    template <class T>
+    struct ArenaAllocator : Allocator<T>
+    {
+        using Type = T;
+        using Allocator<T>::allocate;
+
+        static auto allocate(Arena &p_arena, Size p_count = 1) -> Type *
+        {
+            return (Type *)p_arena.allocate(p_count * sizeof(Type), alignof(Type));
+        }
+    };
+    static_assert(IsAllocatorFeaturesAvailable<ArenaAllocator<X>, X>, "`ArenaAllocator` is malformed.");
+    static_assert(IsArenaAllocator<ArenaAllocator<X>>, "`ArenaAllocator` is malformed.");
+    static_assert(!IsArenaAllocator<Allocator<X>>, "`Allocator` is malformed.");
+
 } // namespace Rong
 
 #endif // RG_CORE_ALLOCATOR_HPP
\ No newline at end of file
@@ -3,6 +3,9 @@
 
 #include "def.hpp"
 #include "leash.hpp"
+#include "pair.hpp"
+#include "list.hpp"
+#include "frozen_binary_tree.hpp"
 
 namespace Rong
 {
@@ -15,70 +18,377 @@ namespace Rong
         using ValueType = V;
         using ElementType = BinaryTree;
         using Allocator = A<ElementType>;
+        /// Nodes carved from an arena are reclaimed with it, so their leashes only deinitialize.
+        using LeashType = Leash<ElementType, IsArenaAllocator<Allocator> ? leash_destruct<ElementType> : leash_default_destroy<ElementType, Allocator>>;
 
     private:
+        struct Arenaless
+        {
+        };
+        using ArenaType = Conditional<IsArenaAllocator<Allocator>, Arena, Arenaless>::Type;
+
+        /// Only a root's arena holds chunks; it is declared first so the nodes in it are destroyed before it is freed.
+        [[no_unique_address]] ArenaType arena;
         KeyType key;
         ValueType value;
-        Leash<ElementType> left;
-        Leash<ElementType> right;
+        LeashType left;
+        LeashType right;
+        Size count;
+        Size height;
 
-    public:
-        BinaryTree() : value(), left(nullptr), right(nullptr) {}
+        inline auto get_left_count() const -> Size { return left ? left->count : 0; }
+        inline auto get_right_count() const -> Size { return right ? right->count : 0; }
+
+        /// Recomputes the augmented fields from the children, which must be up to date.
+        inline auto refresh() -> void
+        {
+            const auto left_height = left ? left->height : 0;
+            const auto right_height = right ? right->height : 0;
+            count = 1 + get_left_count() + get_right_count();
+            height = 1 + (left_height > right_height ? left_height : right_height);
+        }
+
+        /// Advances up to `FIND_GROUP_COUNT` searches in lockstep so their cache misses overlap.
+        template <class T, class R>
+        static auto find_many_from(T *p_root, const ListView<KeyType> &p_keys, List<R *> &p_results) -> void
+        {
+            const auto keys = p_keys.view_data();
+            const auto key_count = p_keys.get_count();
+            p_results.reserve(p_results.get_count() + key_count);
+
+            for (Size begin = 0; begin < key_count; begin += FIND_GROUP_COUNT)
+            {
+                const auto group_count = key_count - begin < FIND_GROUP_COUNT ? key_count - begin : FIND_GROUP_COUNT;
+                T *nodes[FIND_GROUP_COUNT];
+                R *found[FIND_GROUP_COUNT];
+                for (Size i = 0; i < group_count; i++)
+                {
+                    nodes[i] = p_root;
+                    found[i] = nullptr;
+                }
+
+                auto active_count = group_count;
+                while (active_count != 0)
+                {
+                    for (Size i = 0; i < group_count; i++)
+                    {
+                        auto node = nodes[i];
+                        if (node == nullptr)
+                            continue;
+
+                        const auto key_contrast = contrast(keys[begin + i], node->key);
+                        if (key_contrast == 0)
+                        {
+                            found[i] = &node->value;
+                            node = nullptr;
+                        }
+                        else
+                            node = key_contrast < 0 ? *node->left : *node->right;
+
+                        if (node != nullptr)
+                            __builtin_prefetch(node);
+                        else
+                            active_count--;
+                        nodes[i] = node;
+                    }
+                }
+
+                for (Size i = 0; i < group_count; i++)
+                    p_results.append(found[i]);
+            }
+        }
+
+        /// Appends the nodes under `p_root` in key order, without recursion.
+        template <class T>
+        static auto collect(T *p_root, List<T *> &p_nodes) -> void
+        {
+            auto stack = List<T *>();
+            auto node = p_root;
+            while (node != nullptr || stack.get_count() != 0)
+            {
+                while (node != nullptr)
+                {
+                    stack.append(node);
+                    node = *node->left;
+                }
+                node = stack.pop_back();
+                p_nodes.append(node);
+                node = *node->right;
+            }
+        }
+
+        /// Links detached nodes, sorted by key, into a balanced subtree.
+        static auto build(ElementType *const *p_nodes, Size p_count) -> LeashType
+        {
+            if (p_count == 0)
+                return LeashType(nullptr);
+
+            const auto middle = p_count / 2;
+            auto tree = LeashType(p_nodes[middle]);
+            tree->left = build(p_nodes, middle);
+            tree->right = build(p_nodes + middle + 1, p_count - middle - 1);
+            tree->refresh();
+            return tree;
+        }
+
+        static auto allocate(ArenaType &p_arena) -> ElementType *
+        {
+            if constexpr (IsArenaAllocator<Allocator>)
+                return Allocator::allocate(p_arena);
+            else
+                return Allocator::allocate();
+        }
 
-        BinaryTree(const KeyType &p_key, const ValueType &p_value, Leash<ElementType> p_left, Leash<ElementType> p_right) : key(p_key), value(p_value), left(move(p_left)), right(move(p_right)) {}
-        BinaryTree(const BinaryTree &p_tree) : key(p_tree.key), value(p_tree.value), left(nullptr), right(nullptr)
+        /// Makes the nodes of `p_tree` live as long as this tree's own.
+        inline auto adopt(LeashType &p_tree) -> void
         {
-            const auto left_copied = **left;
-            const auto right_copied = **right;
-            left = Leash(left_copied);
-            right = Leash(right_copied);
+            if constexpr (IsArenaAllocator<Allocator>)
+                arena.adopt(p_tree->arena);
         }
+
+        static auto copy(const LeashType &p_tree, ArenaType &p_arena) -> LeashType
+        {
+            if (!p_tree)
+                return LeashType(nullptr);
+
+            auto tree = LeashType(allocate(p_arena));
+            tree->key = p_tree->key;
+            tree->value = p_tree->value;
+            tree->left = copy(p_tree->left, p_arena);
+            tree->right = copy(p_tree->right, p_arena);
+            tree->count = p_tree->count;
+            tree->height = p_tree->height;
+            return tree;
+        }
+
+    public:
+        static constexpr const Size FIND_GROUP_COUNT = 8;
+        static constexpr const Size FOR_EACH_STACK_CAPACITY = 64;
+
+        BinaryTree() : arena(), key(), value(), left(nullptr), right(nullptr), count(1), height(1) {}
+
+        BinaryTree(const KeyType &p_key, const ValueType &p_value, LeashType p_left, LeashType p_right) : arena(), key(p_key), value(p_value), left(move(p_left)), right(move(p_right)) { refresh(); }
+        BinaryTree(const BinaryTree &p_tree) : arena(), key(p_tree.key), value(p_tree.value), left(copy(p_tree.left, arena)), right(copy(p_tree.right, arena)), count(p_tree.count), height(p_tree.height) {}
         BinaryTree(BinaryTree &&p_tree) = default;
 
-        auto operator[](const KeyType &p_key) -> ValueType &
+        /// Frees the subtrees without recursion by rotating them into a right-leaning chain.
+        ~BinaryTree()
         {
-            const auto key_contrast = contrast(p_key, key);
-            if (key_contrast == 0)
-                return value;
-            else if (key_contrast < 0)
+            if constexpr (IsTriviallyDestructible<KeyType> && IsTriviallyDestructible<ValueType> && IsArenaAllocator<Allocator>)
             {
-                if (!left)
-                    throw Exception<LOGICAL>("Given key is not in the tree.");
-                return (**left)[p_key];
+                // Nothing to destroy, and the memory goes with the root's arena.
+                left.release();
+                right.release();
             }
             else
             {
-                if (!right)
-                    throw Exception<LOGICAL>("Given key is not in the tree.");
-                return (**right)[p_key];
+                auto node = left.release();
+                auto rest = right.release();
+                while (node != nullptr || rest != nullptr)
+                {
+                    if (node == nullptr)
+                    {
+                        node = rest;
+                        rest = nullptr;
+                    }
+
+                    if (node->left)
+                    {
+                        auto child = node->left.release();
+                        node->left = LeashType(child->right.release());
+                        child->right = LeashType(node);
+                        node = child;
+                    }
+                    else
+                    {
+                        auto next = node->right.release();
+                        auto discarded = LeashType(node);
+                        node = next;
+                    }
+                }
             }
         }
 
+        auto operator[](const KeyType &p_key) -> ValueType &
+        {
+            const auto found = find(p_key);
+            if (found == nullptr)
+                throw Exception<LOGICAL>("Given key is not in the tree.");
+            return *found;
+        }
+
         inline auto operator[](const KeyType &p_key) const -> const ValueType &
         {
-            const auto key_contrast = contrast(p_key, key);
-            if (key_contrast == 0)
-                return value;
-            else if (key_contrast < 0)
+            const auto found = find(p_key);
+            if (found == nullptr)
+                throw Exception<LOGICAL>("Given key is not in the tree.");
+            return *found;
+        }
+
+        /// Builds a balanced tree in linear time from strictly ascending keys; an empty leash stands for an empty tree.
+        static auto from_sorted(const ListView<KeyType> &p_keys, const ListView<ValueType> &p_values) -> LeashType
+        {
+            if (p_keys.get_count() != p_values.get_count())
+                throw Exception<LOGICAL>("Given keys and values differ in count.");
+
+            const auto keys = p_keys.view_data();
+            const auto values = p_values.view_data();
+            auto arena = ArenaType();
+            auto nodes = List<ElementType *>(p_keys.get_count());
+            for (Size i = 0; i < p_keys.get_count(); i++)
             {
-                if (!left)
-                    throw Exception<LOGICAL>("Given key is not in the tree.");
-                return (**left)[p_key];
+                if (i != 0 && contrast(keys[i - 1], keys[i]) >= 0)
+                {
+                    for (auto node : nodes)
+                        auto discarded = LeashType(node);
+                    throw Exception<LOGICAL>("Given keys are not sorted.");
+                }
+
+                auto node = allocate(arena);
+                node->key = keys[i];
+                node->value = values[i];
+                node->left = LeashType(nullptr);
+                node->right = LeashType(nullptr);
+                nodes.append(node);
             }
-            else
+            auto tree = build(nodes.view_data(), nodes.get_count());
+            if (tree)
+                tree->arena = move(arena);
+            return tree;
+        }
+
+        /// Moves every node of `p_tree` into this tree and rebalances both in O(N + M).
+        /// `p_resolver(key, current, incoming)` decides the value of keys present in both.
+        template <class R>
+            requires IsFunction<ValueType, R, const KeyType &, const ValueType &, const ValueType &>
+        auto merge(LeashType p_tree, const R &p_resolver) -> void
+        {
+            if (!p_tree)
+                return;
+
+            adopt(p_tree);
+            auto current = List<ElementType *>(count);
+            auto incoming = List<ElementType *>(p_tree->count);
+            collect(this, current);
+            collect(*p_tree, incoming);
+
+            // Every resolver call happens while both trees are still intact, so a throwing resolver leaves them as they were.
+            auto merged = List<ElementType *>(current.get_count() + incoming.get_count());
+            auto resolved_nodes = List<ElementType *>();
+            auto resolved_values = List<ValueType>();
+            auto discarded = List<ElementType *>();
+            Size root_index = 0;
+            Size current_index = 0;
+            Size incoming_index = 0;
+            while (current_index < current.get_count() || incoming_index < incoming.get_count())
             {
-                if (!right)
-                    throw Exception<LOGICAL>("Given key is not in the tree.");
-                return (**right)[p_key];
+                if (incoming_index == incoming.get_count())
+                {
+                    if (current[current_index] == this)
+                        root_index = merged.get_count();
+                    merged.append(current[current_index++]);
+                    continue;
+                }
+                if (current_index == current.get_count())
+                {
+                    merged.append(incoming[incoming_index++]);
+                    continue;
+                }
+
+                const auto current_node = current[current_index];
+                const auto incoming_node = incoming[incoming_index];
+                const auto key_contrast = contrast(current_node->key, incoming_node->key);
+                if (key_contrast < 0)
+                {
+                    if (current_node == this)
+                        root_index = merged.get_count();
+                    merged.append(current_node);
+                    current_index++;
+                }
+                else if (key_contrast > 0)
+                {
+                    merged.append(incoming_node);
+                    incoming_index++;
+                }
+                else
+                {
+                    resolved_values.append(p_resolver(current_node->key, current_node->value, incoming_node->value));
+                    resolved_nodes.append(current_node);
+                    discarded.append(incoming_node);
+                    if (current_node == this)
+                        root_index = merged.get_count();
+                    merged.append(current_node);
+                    current_index++;
+                    incoming_index++;
+                }
+            }
+
+            p_tree.release();
+            for (auto node : current)
+            {
+                node->left.release();
+                node->right.release();
             }
+            for (auto node : incoming)
+            {
+                node->left.release();
+                node->right.release();
+            }
+            for (Size i = 0; i < resolved_nodes.get_count(); i++)
+                resolved_nodes[i]->value = move(resolved_values[i]);
+            for (auto node : discarded)
+                auto discarded_node = LeashType(node);
+
+            // This node cannot be relinked, so it takes over the middle entry instead.
+            const auto middle = merged.get_count() / 2;
+            if (root_index != middle)
+            {
+                const auto middle_node = merged[middle];
+                auto swapped_key = move(key);
+                auto swapped_value = move(value);
+                key = move(middle_node->key);
+                value = move(middle_node->value);
+                middle_node->key = move(swapped_key);
+                middle_node->value = move(swapped_value);
+                merged[root_index] = middle_node;
+            }
+            left = build(merged.view_data(), middle);
+            right = build(merged.view_data() + middle + 1, merged.get_count() - middle - 1);
+            refresh();
         }
 
+        inline auto merge(LeashType p_tree) -> void
+        {
+            merge(move(p_tree), [](const KeyType &, const ValueType &, const ValueType &p_incoming) -> ValueType
+                  { return p_incoming; });
+        }
+
+        auto find(const KeyType &p_key) -> ValueType *
+        {
+            BinaryTree *node = this;
+            while (node != nullptr)
+            {
+                const auto key_contrast = contrast(p_key, node->key);
+                if (key_contrast == 0)
+                    return &node->value;
+                node = key_contrast < 0 ? *node->left : *node->right;
+            }
+            return nullptr;
+        }
+
+        inline auto find(const KeyType &p_key) const -> const ValueType * { return const_cast<BinaryTree *>(this)->find(p_key); }
+        inline auto contains(const KeyType &p_key) const -> B { return find(p_key) != nullptr; }
+
+        /// Appends the value of each key in `p_keys` to `p_results`, or nullptr when the key is absent.
+        inline auto find_many(const ListView<KeyType> &p_keys, List<ValueType *> &p_results) -> void { find_many_from(this, p_keys, p_results); }
+        inline auto find_many(const ListView<KeyType> &p_keys, List<const ValueType *> &p_results) const -> void { find_many_from(this, p_keys, p_results); }
+
+        inline auto get_count() const -> Size { return count; }
+        inline auto get_height() const -> Size { return height; }
+
         auto compute_height(Size p_initial_height = 0) -> Size const
         {
-            const auto height = p_initial_height + 1;
-            const auto left_count = left ? left->compute_height(height) : height;
-            const auto right_count = right ? right->compute_height(height) : height;
-            return left_count > right_count ? left_count : right_count;
+            return p_initial_height + height;
         }
 
         auto compute_left_count(Size p_initial_count = 0) -> Size const
@@ -97,40 +407,62 @@ namespace Rong
             return count;
         }
 
-        auto set(Leash<ElementType> p_tree) -> void
+        /// Inserts a single node along its search path; a subtree may overlap existing keys, so it is merged instead.
+        auto set(LeashType p_tree) -> void
         {
             if (!p_tree)
                 throw Exception<LOGICAL>("An empty tree is given.");
 
-            const auto key_contrast = contrast(p_tree->key, key);
-            if (key_contrast == 0)
+            adopt(p_tree);
+            if (p_tree->left || p_tree->right)
             {
-                /// TODO: Implement this. Merge the `p_tree` children with current children.
-                throw Exception<LOGICAL>("Unable to update tree.");
+                merge(move(p_tree));
+                return;
             }
-            else if (key_contrast > 0)
+
+            Size depth = 0;
+            for (BinaryTree *node = this; true; depth++)
             {
-                if (right)
-                    right->set(move(p_tree));
-                else
-                    right = move(p_tree);
+                const auto key_contrast = contrast(p_tree->key, node->key);
+                if (key_contrast == 0)
+                {
+                    node->value = move(p_tree->value);
+                    return;
+                }
+
+                const auto child = key_contrast < 0 ? *node->left : *node->right;
+                if (child == nullptr)
+                    break;
+                node = child;
             }
-            else
+
+            // The key is new, so every node on its path gains one descendant and possibly height.
+            BinaryTree *node = this;
+            for (Size level = 0; true; level++)
             {
-                if (left)
-                    left->set(move(p_tree));
-                else
-                    left = move(p_tree);
+                node->count++;
+                if (node->height < depth - level + 2)
+                    node->height = depth - level + 2;
+
+                auto &child = contrast(p_tree->key, node->key) < 0 ? node->left : node->right;
+                if (!child)
+                {
+                    child = move(p_tree);
+                    return;
+                }
+                node = *child;
             }
         }
 
         inline auto set(const KeyType &p_key, const ValueType &p_value) -> void
         {
-            auto tree = Leash(Allocator::allocate());
+            auto tree = LeashType(allocate(arena));
             tree->key = p_key;
             tree->value = p_value;
-            tree->left = Leash<ElementType>(nullptr);
-            tree->right = Leash<ElementType>(nullptr);
+            tree->left = LeashType(nullptr);
+            tree->right = LeashType(nullptr);
+            tree->count = 1;
+            tree->height = 1;
             set(move(tree));
         }
 
@@ -151,14 +483,14 @@ namespace Rong
                 new_left->key = move(key);
                 new_left->value = move(value);
                 new_left->left = move(left);
+                new_left->right = move(popped);
+                new_left->refresh();
 
                 key = move(new_key);
                 value = move(new_value);
                 left = move(new_left);
                 right = move(new_right);
-
-                if (popped)
-                    set(move(popped));
+                refresh();
             }
             return true;
         }
@@ -179,20 +511,108 @@ namespace Rong
 
                 new_right->key = move(key);
                 new_right->value = move(value);
+                new_right->left = move(popped);
                 new_right->right = move(right);
+                new_right->refresh();
 
                 key = move(new_key);
                 value = move(new_value);
                 left = move(new_left);
                 right = move(new_right);
-
-                if (popped)
-                    set(move(popped));
+                refresh();
             }
 
             return true;
         }
 
+        /// In-order walk keeping at most `height` ancestors; only trees taller than `FOR_EACH_STACK_CAPACITY` touch the heap.
+        template <class C>
+        auto for_each(const C &p_callable) const -> void
+        {
+            const BinaryTree *inline_stack[FOR_EACH_STACK_CAPACITY];
+            auto spilled_stack = List<const BinaryTree *>();
+            auto stack = inline_stack;
+            if (height > FOR_EACH_STACK_CAPACITY)
+            {
+                spilled_stack.resize(height);
+                stack = spilled_stack.access_data();
+            }
+
+            Size depth = 0;
+            const BinaryTree *node = this;
+            while (node != nullptr || depth != 0)
+            {
+                while (node != nullptr)
+                {
+                    stack[depth++] = node;
+                    node = *node->left;
+                }
+                node = stack[--depth];
+                p_callable(node->key, node->value);
+                node = *node->right;
+            }
+        }
+
+        auto freeze() const -> FrozenBinaryTree<KeyType, ValueType, A>
+        {
+            return FrozenBinaryTree<KeyType, ValueType, A>(*this, count);
+        }
+
+        /// Number of keys strictly less than `p_key`.
+        auto rank(const KeyType &p_key) const -> Size
+        {
+            Size result = 0;
+            const BinaryTree *node = this;
+            while (node != nullptr)
+            {
+                const auto key_contrast = contrast(p_key, node->key);
+                if (key_contrast <= 0)
+                    node = *node->left;
+                else
+                {
+                    result += node->get_left_count() + 1;
+                    node = *node->right;
+                }
+            }
+            return result;
+        }
+
+        /// Entry at in-order position `p_index`.
+        auto select(Size p_index) -> Pair<const KeyType &, ValueType &>
+        {
+            if (p_index >= count)
+                throw Exception<LOGICAL>("Given index is beyond tree's element count.");
+
+            BinaryTree *node = this;
+            while (true)
+            {
+                const auto left_count = node->get_left_count();
+                if (p_index < left_count)
+                    node = *node->left;
+                else if (p_index == left_count)
+                    return Pair<const KeyType &, ValueType &>(node->key, node->value);
+                else
+                {
+                    p_index -= left_count + 1;
+                    node = *node->right;
+                }
+            }
+        }
+
+        inline auto select(Size p_index) const -> Pair<const KeyType &, const ValueType &>
+        {
+            auto selected = const_cast<BinaryTree *>(this)->select(p_index);
+            return Pair<const KeyType &, const ValueType &>(selected.first, selected.second);
+        }
+
+        /// Entry at the nearest lower rank of `p_ratio` in `[0, 1]`, e.g. 0.5 for the median.
+        inline auto percentile(F64 p_ratio) const -> Pair<const KeyType &, const ValueType &>
+        {
+            if (!(p_ratio >= 0 && p_ratio <= 1))
+                throw Exception<LOGICAL>("Given ratio is not within [0, 1].");
+            return select(static_cast<Size>(p_ratio * (count - 1)));
+        }
+
         auto balance() -> void
         {
             if (left)
@@ -200,18 +620,117 @@ namespace Rong
             if (right)
                 right->balance();
 
-            const auto left_count = compute_left_count();
-            const auto right_count = compute_right_count();
+            // Rotate toward the lighter side for as long as it narrows the size difference.
+            while (true)
+            {
+                const auto left_count = get_left_count();
+                const auto right_count = get_right_count();
 
-            if (left_count == right_count)
-                return;
-            else if (left_count > right_count)
-                rotate_right((left_count - right_count) / 2);
-            else
-                rotate_left((right_count - left_count) / 2);
+                if (left_count > right_count + 1)
+                {
+                    const auto new_left_count = left->get_left_count();
+                    const auto new_right_count = right_count + 1 + left->get_right_count();
+                    const auto new_difference = new_left_count > new_right_count ? new_left_count - new_right_count : new_right_count - new_left_count;
+                    if (new_difference >= left_count - right_count)
+                        return;
+                    rotate_right();
+                }
+                else if (right_count > left_count + 1)
+                {
+                    const auto new_right_count = right->get_right_count();
+                    const auto new_left_count = left_count + 1 + right->get_left_count();
+                    const auto new_difference = new_left_count > new_right_count ? new_left_count - new_right_count : new_right_count - new_left_count;
+                    if (new_difference >= right_count - left_count)
+                        return;
+                    rotate_left();
+                }
+                else
+                    return;
+            }
         }
     };
 
+    template <class T, class R>
+    auto binary_tree_combine(const T &p_left, const T &p_right, B p_keep_left, B p_keep_right, B p_keep_both, const R &p_resolver) -> typename T::LeashType
+    {
+        using KeyType = typename T::KeyType;
+        using ValueType = typename T::ValueType;
+
+        auto left_keys = List<KeyType>(p_left.get_count());
+        auto left_values = List<ValueType>(p_left.get_count());
+        p_left.for_each([&](const KeyType &p_key, const ValueType &p_value)
+                        { left_keys.append(p_key); left_values.append(p_value); });
+        auto right_keys = List<KeyType>(p_right.get_count());
+        auto right_values = List<ValueType>(p_right.get_count());
+        p_right.for_each([&](const KeyType &p_key, const ValueType &p_value)
+                         { right_keys.append(p_key); right_values.append(p_value); });
+
+        auto keys = List<KeyType>(left_keys.get_count() + right_keys.get_count());
+        auto values = List<ValueType>(left_keys.get_count() + right_keys.get_count());
+        Size left_index = 0;
+        Size right_index = 0;
+        while (left_index < left_keys.get_count() || right_index < right_keys.get_count())
+        {
+            const auto key_contrast = left_index == left_keys.get_count()    ? 1
+                                      : right_index == right_keys.get_count() ? -1
+                                                                              : contrast(left_keys[left_index], right_keys[right_index]);
+            if (key_contrast < 0)
+            {
+                if (p_keep_left)
+                {
+                    keys.append(left_keys[left_index]);
+                    values.append(left_values[left_index]);
+                }
+                left_index++;
+            }
+            else if (key_contrast > 0)
+            {
+                if (p_keep_right)
+                {
+                    keys.append(right_keys[right_index]);
+                    values.append(right_values[right_index]);
+                }
+                right_index++;
+            }
+            else
+            {
+                if (p_keep_both)
+                {
+                    keys.append(left_keys[left_index]);
+                    values.append(p_resolver(left_keys[left_index], left_values[left_index], right_values[right_index]));
+                }
+                left_index++;
+                right_index++;
+            }
+        }
+
+        return T::from_sorted(keys, values);
+    }
+
+    /// Keys of either tree; `p_resolver(key, left, right)` decides the value of keys in both.
+    template <class T, class R>
+        requires IsFunction<typename T::ValueType, R, const typename T::KeyType &, const typename T::ValueType &, const typename T::ValueType &>
+    inline auto binary_tree_union(const T &p_left, const T &p_right, const R &p_resolver) -> typename T::LeashType
+    {
+        return binary_tree_combine(p_left, p_right, true, true, true, p_resolver);
+    }
+
+    /// Keys of both trees; `p_resolver(key, left, right)` decides their value.
+    template <class T, class R>
+        requires IsFunction<typename T::ValueType, R, const typename T::KeyType &, const typename T::ValueType &, const typename T::ValueType &>
+    inline auto binary_tree_intersection(const T &p_left, const T &p_right, const R &p_resolver) -> typename T::LeashType
+    {
+        return binary_tree_combine(p_left, p_right, false, false, true, p_resolver);
+    }
+
+    /// Keys of `p_left` that are not in `p_right`.
+    template <class T>
+    inline auto binary_tree_difference(const T &p_left, const T &p_right) -> typename T::LeashType
+    {
+        return binary_tree_combine(p_left, p_right, true, false, false, [](const typename T::KeyType &, const typename T::ValueType &p_value, const typename T::ValueType &)
+                                   { return p_value; });
+    }
+
 } // namespace Rong
 
 #endif // RG_CORE_BINARY_TREE
\ No newline at end of file
@@ -0,0 +1,151 @@
+#ifndef RG_CORE_CONCURRENT_HASH_MAP_HPP
+#define RG_CORE_CONCURRENT_HASH_MAP_HPP
+
+#include "def.hpp"
+#include "exception.hpp"
+#include "allocator.hpp"
+#include "lock.hpp"
+#include "hash_map.hpp"
+
+namespace Rong
+{
+    /// `HashMap` split into independently locked shards, so writers to different shards never wait on each other.
+    /// Lookups copy the value out, since a reference would outlive the shard lock.
+    template <IsHashAvailable K, class V, template <class E> class A = Allocator, Size ShardBits = 6>
+        requires IsConstrastAvailable<K> && IsAllocatorFeaturesAvailable<A<X>, X>
+    class ConcurrentHashMap
+    {
+    public:
+        using KeyType = K;
+        using ValueType = V;
+        using MapType = HashMap<KeyType, ValueType, A>;
+        static constexpr const Size SHARD_COUNT = static_cast<Size>(1) << ShardBits;
+
+        static_assert(ShardBits > 0 && ShardBits < 64, "Shard bits must select the shard from between 1 and 63 top hash bits.");
+
+    private:
+        class alignas(CACHE_LINE_SIZE) Shard
+        {
+        public:
+            mutable ReadWriteLock lock;
+            MapType map;
+        };
+
+        Shard shards[SHARD_COUNT];
+
+        /// Shards are picked by the top hash bits; the bottom ones already place the key inside its shard.
+        inline auto get_shard(const KeyType &p_key) -> Shard & { return shards[hash(p_key) >> (64 - ShardBits)]; }
+        inline auto get_shard(const KeyType &p_key) const -> const Shard & { return const_cast<ConcurrentHashMap *>(this)->get_shard(p_key); }
+
+    public:
+        ConcurrentHashMap() = default;
+        ConcurrentHashMap(const ConcurrentHashMap &p_map) = delete;
+        ConcurrentHashMap(ConcurrentHashMap &&p_map) = delete;
+
+        /// Sum of every shard's count; only exact while no writer is running.
+        auto get_count() const -> Size
+        {
+            Size count = 0;
+            for (auto &shard : shards)
+            {
+                auto guard = ReadGuard(shard.lock);
+                count += shard.map.get_count();
+            }
+            return count;
+        }
+
+        auto contains(const KeyType &p_key) const -> B
+        {
+            auto &shard = get_shard(p_key);
+            auto guard = ReadGuard(shard.lock);
+            return shard.map.contains(p_key);
+        }
+
+        /// Copies the value of `p_key` into `p_value`; returns false when the key is absent.
+        auto find(const KeyType &p_key, ValueType &p_value) const -> B
+        {
+            auto &shard = get_shard(p_key);
+            auto guard = ReadGuard(shard.lock);
+            const auto found = shard.map.find(p_key);
+            if (found == nullptr)
+                return false;
+            p_value = *found;
+            return true;
+        }
+
+        auto operator[](const KeyType &p_key) const -> ValueType
+        {
+            auto &shard = get_shard(p_key);
+            auto guard = ReadGuard(shard.lock);
+            return shard.map[p_key];
+        }
+
+        auto set(const KeyType &p_key, const ValueType &p_value) -> void
+        {
+            auto &shard = get_shard(p_key);
+            auto guard = WriteGuard(shard.lock);
+            shard.map.set(p_key, p_value);
+        }
+
+        /// Calls `p_callable` on the value of `p_key` while its shard is held exclusively, inserting `p_initial` first when absent.
+        template <class C>
+        auto update(const KeyType &p_key, const ValueType &p_initial, const C &p_callable) -> void
+        {
+            auto &shard = get_shard(p_key);
+            auto guard = WriteGuard(shard.lock);
+            auto found = shard.map.find(p_key);
+            if (found == nullptr)
+            {
+                shard.map.set(p_key, p_initial);
+                found = shard.map.find(p_key);
+            }
+            p_callable(*found);
+        }
+
+        auto remove(const KeyType &p_key) -> ValueType
+        {
+            auto &shard = get_shard(p_key);
+            auto guard = WriteGuard(shard.lock);
+            return shard.map.remove(p_key);
+        }
+
+        /// Spreads `p_min_count` elements evenly over the shards.
+        auto reserve(Size p_min_count) -> void
+        {
+            for (auto &shard : shards)
+            {
+                auto guard = WriteGuard(shard.lock);
+                shard.map.reserve((p_min_count + SHARD_COUNT - 1) / SHARD_COUNT);
+            }
+        }
+
+        /// Visits shard by shard; each shard is seen consistently, but not the whole map at once.
+        template <class C>
+        auto for_each(const C &p_callable) const -> void
+        {
+            for (auto &shard : shards)
+            {
+                auto guard = ReadGuard(shard.lock);
+                shard.map.for_each(p_callable);
+            }
+        }
+
+        auto clean() -> void
+        {
+            for (auto &shard : shards)
+            {
+                auto guard = WriteGuard(shard.lock);
+                shard.map.clean();
+            }
+        }
+    };
+
+#ifdef FEATURE_ASSERTION
+    static_assert(IsSetAvailable<ConcurrentHashMap<U, X>>, "`ConcurrentHashMap::set` is malformed.");
+    static_assert(IsCleanAvailable<ConcurrentHashMap<U, X>>, "`ConcurrentHashMap::clean` is malformed.");
+    static_assert(IsCountAvailable<ConcurrentHashMap<U, X>>, "`ConcurrentHashMap::get_count` is malformed.");
+#endif // FEATURE_ASSERTION
+
+} // namespace Rong
+
+#endif // RG_CORE_CONCURRENT_HASH_MAP_HPP
\ No newline at end of file
@@ -0,0 +1,177 @@
+#ifndef RG_CORE_CONCURRENT_QUEUE_HPP
+#define RG_CORE_CONCURRENT_QUEUE_HPP
+
+#include "def.hpp"
+#include "exception.hpp"
+#include "allocator.hpp"
+#include "list.hpp"
+
+namespace Rong
+{
+    template <class T>
+    class ConcurrentQueueCell
+    {
+    public:
+        using ValueType = T;
+
+    private:
+    public:
+        /// Position the cell is ready for: `p` when free for the `p`-th enqueue, `p + 1` once that element is readable.
+        Size sequence;
+        ValueType value;
+    };
+
+    /// Bounded multi-producer multi-consumer ring queue that never blocks; full and empty are reported instead.
+    template <class T, template <class E> class A = Allocator>
+        requires IsAllocatorFeaturesAvailable<A<X>, X>
+    class alignas(CACHE_LINE_SIZE) ConcurrentQueue
+    {
+    public:
+        using ValueType = T;
+        using ElementType = ConcurrentQueueCell<ValueType>;
+        using Allocator = A<ElementType>;
+
+    private:
+        ElementType *cells;
+        Size capacity;
+        alignas(CACHE_LINE_SIZE) Size enqueue_position;
+        alignas(CACHE_LINE_SIZE) Size dequeue_position;
+
+        /// Claims up to `p_count` consecutive cells that are `p_lag` ahead of `p_position`, returning the first claimed position.
+        inline auto claim(Size &p_position, Size p_lag, Size &p_count) -> Size
+        {
+            auto position = __atomic_load_n(&p_position, __ATOMIC_RELAXED);
+            while (true)
+            {
+                Size ready = 0;
+                while (ready < p_count)
+                {
+                    const auto sequence = __atomic_load_n(&cells[(position + ready) & (capacity - 1)].sequence, __ATOMIC_ACQUIRE);
+                    if (sequence != position + ready + p_lag)
+                        break;
+                    ready++;
+                }
+
+                if (ready == 0)
+                {
+                    const auto sequence = __atomic_load_n(&cells[position & (capacity - 1)].sequence, __ATOMIC_ACQUIRE);
+                    // Behind the cell: the queue is full (or empty); ahead of it: another thread claimed it first.
+                    if (static_cast<I64>(sequence - (position + p_lag)) < 0)
+                    {
+                        p_count = 0;
+                        return position;
+                    }
+                    position = __atomic_load_n(&p_position, __ATOMIC_RELAXED);
+                    continue;
+                }
+
+                if (__atomic_compare_exchange_n(&p_position, &position, position + ready, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+                {
+                    p_count = ready;
+                    return position;
+                }
+            }
+        }
+
+    public:
+        ConcurrentQueue(Size p_capacity) : cells(nullptr), capacity(p_capacity), enqueue_position(0), dequeue_position(0)
+        {
+            if (capacity < 2 || (capacity & (capacity - 1)) != 0)
+                throw Exception<LOGICAL>("Queue capacity must be a power of two.");
+
+            cells = Allocator::allocate(capacity);
+            for (Size i = 0; i < capacity; i++)
+                cells[i].sequence = i;
+        }
+
+        ConcurrentQueue(const ConcurrentQueue &p_queue) = delete;
+        ConcurrentQueue(ConcurrentQueue &&p_queue) = delete;
+
+        ~ConcurrentQueue()
+        {
+            for (auto position = dequeue_position; position != enqueue_position; position++)
+                cells[position & (capacity - 1)].value.~ValueType();
+            Allocator::deallocate(cells);
+            cells = nullptr;
+        }
+
+        inline auto get_capacity() const -> Size { return capacity; }
+
+        /// Approximate while other threads are running.
+        inline auto get_count() const -> Size
+        {
+            const auto dequeued = __atomic_load_n(&dequeue_position, __ATOMIC_RELAXED);
+            const auto enqueued = __atomic_load_n(&enqueue_position, __ATOMIC_RELAXED);
+            return enqueued > dequeued ? enqueued - dequeued : 0;
+        }
+
+        /// Returns false when the queue is full.
+        auto enqueue(const ValueType &p_value) -> B
+        {
+            Size count = 1;
+            const auto position = claim(enqueue_position, 0, count);
+            if (count == 0)
+                return false;
+
+            auto &cell = cells[position & (capacity - 1)];
+            cell.value = p_value;
+            __atomic_store_n(&cell.sequence, position + 1, __ATOMIC_RELEASE);
+            return true;
+        }
+
+        /// Returns false when the queue is empty.
+        auto dequeue(ValueType &p_value) -> B
+        {
+            Size count = 1;
+            const auto position = claim(dequeue_position, 1, count);
+            if (count == 0)
+                return false;
+
+            auto &cell = cells[position & (capacity - 1)];
+            p_value = move(cell.value);
+            cell.value.~ValueType();
+            __atomic_store_n(&cell.sequence, position + capacity, __ATOMIC_RELEASE);
+            return true;
+        }
+
+        /// Enqueues a prefix of `p_values` with a single claim; returns how many fit.
+        auto enqueue_many(const ListView<ValueType> &p_values) -> Size
+        {
+            auto count = p_values.get_count();
+            if (count == 0)
+                return 0;
+            const auto position = claim(enqueue_position, 0, count);
+
+            const auto data = p_values.view_data();
+            for (Size i = 0; i < count; i++)
+            {
+                auto &cell = cells[(position + i) & (capacity - 1)];
+                cell.value = data[i];
+                __atomic_store_n(&cell.sequence, position + i + 1, __ATOMIC_RELEASE);
+            }
+            return count;
+        }
+
+        /// Appends up to `p_max_count` elements to `p_values` with a single claim; returns how many were taken.
+        auto dequeue_many(List<ValueType> &p_values, Size p_max_count) -> Size
+        {
+            auto count = p_max_count;
+            if (count == 0)
+                return 0;
+            const auto position = claim(dequeue_position, 1, count);
+
+            p_values.reserve(p_values.get_count() + count);
+            for (Size i = 0; i < count; i++)
+            {
+                auto &cell = cells[(position + i) & (capacity - 1)];
+                p_values.append(cell.value);
+                cell.value.~ValueType();
+                __atomic_store_n(&cell.sequence, position + i + capacity, __ATOMIC_RELEASE);
+            }
+            return count;
+        }
+    };
+
+} // namespace Rong
+
+#endif // RG_CORE_CONCURRENT_QUEUE_HPP
\ No newline at end of file
@@ -3,6 +3,7 @@
 
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 
 namespace Rong
 {
@@ -29,6 +30,9 @@ namespace Rong
 
     using Nullptr = decltype(nullptr);
 
+    /// Alignment that keeps independently written state off each other's cache lines.
+    constexpr const Size CACHE_LINE_SIZE = 64;
+
     template <class R, class... Args>
     using Function = R(Args...);
 
@@ -105,6 +109,18 @@ namespace Rong
         using Type = Volatileless<typename Constantless<typename Referenceless<T>::Type>::Type>::Type;
     };
 
+    template <B Condition, class T, class W>
+    struct Conditional : Inconstructible
+    {
+        using Type = T;
+    };
+
+    template <class T, class W>
+    struct Conditional<false, T, W> : Inconstructible
+    {
+        using Type = W;
+    };
+
     template <class... T>
     struct Parameters : Inconstructible
     {
@@ -134,6 +150,26 @@ namespace Rong
         using Type = T;
     };
 
+    /// Tag carrying `0, 1, ..., N - 1`, so a parameter pack can be expanded alongside its positions.
+    template <Size... Index>
+    struct IndexSequence
+    {
+    };
+
+    template <Size Count, Size... Index>
+    struct IndexSequenceMaker : IndexSequenceMaker<Count - 1, Count - 1, Index...>
+    {
+    };
+
+    template <Size... Index>
+    struct IndexSequenceMaker<0, Index...>
+    {
+        using Type = IndexSequence<Index...>;
+    };
+
+    template <Size Count>
+    using MakeIndexSequence = IndexSequenceMaker<Count>::Type;
+
     template <class T, class... W>
     struct TypeIndex : Inconstructible
     {
@@ -189,6 +225,17 @@ namespace Rong
     template <class T>
     concept IsNumber = IsInteger<T> || IsFloat<T>;
 
+    // GCC only gained `__is_trivially_destructible` in version 14; older releases keep the deprecated trait.
+    template <class T>
+#if __has_builtin(__is_trivially_destructible)
+    concept IsTriviallyDestructible = __is_trivially_destructible(T);
+#else
+    concept IsTriviallyDestructible = __has_trivial_destructor(T);
+#endif
+
+    template <class T>
+    concept IsTriviallyCopyable = __is_trivially_copyable(T);
+
     template <class R, class T, class... Args>
     concept IsFunction = requires(const T &p_object, Args... p_items) {
         {
@@ -233,9 +280,9 @@ namespace Rong
     };
 
     template <class T>
-    concept IsDataAccessible = IsElementTypeAvailable<T> && requires(const T &p_object) {
+    concept IsDataAccessible = IsElementTypeAvailable<T> && requires(T &p_object) {
         {
-            p_object.data
+            p_object.access_data()
         } -> IsSame<typename T::ElementType *>;
     };
 
@@ -311,6 +358,101 @@ namespace Rong
         } -> IsSame<I>;
     };
 
+    constexpr const U64 HASH_SECRETS[] = {0xa0761d6478bd642full, 0xe7037ed1a0b428dbull, 0x8ebc6af09c88c6e3ull, 0x589965cc75374cc3ull};
+
+    /// Folds the 128-bit product of `p_left` and `p_right` into 64 bits.
+    inline auto hash_mix(U64 p_left, U64 p_right) -> U64
+    {
+        const auto product = static_cast<__uint128_t>(p_left) * p_right;
+        return static_cast<U64>(product) ^ static_cast<U64>(product >> 64);
+    }
+
+    inline auto hash_combine(U64 p_seed, U64 p_hash) -> U64
+    {
+        return hash_mix(p_seed ^ HASH_SECRETS[0], p_hash ^ HASH_SECRETS[1]);
+    }
+
+    /// Wyhash-style hash of raw bytes. Long inputs are consumed 48 bytes per round by three independent multiply lanes.
+    inline auto hash_bytes(const void *p_data, Size p_count, U64 p_seed = 0) -> U64
+    {
+        const auto read_64 = [](const U8 *p_bytes) -> U64
+        {
+            U64 result;
+            memcpy(&result, p_bytes, sizeof(result));
+            return result;
+        };
+        const auto read_32 = [](const U8 *p_bytes) -> U64
+        {
+            U32 result;
+            memcpy(&result, p_bytes, sizeof(result));
+            return result;
+        };
+
+        auto bytes = static_cast<const U8 *>(p_data);
+        auto seed = p_seed ^ hash_mix(p_seed ^ HASH_SECRETS[0], HASH_SECRETS[1]);
+        U64 first = 0;
+        U64 second = 0;
+        if (p_count <= 16)
+        {
+            if (p_count >= 4)
+            {
+                const auto middle = (p_count >> 3) << 2;
+                first = (read_32(bytes) << 32) | read_32(bytes + middle);
+                second = (read_32(bytes + p_count - 4) << 32) | read_32(bytes + p_count - 4 - middle);
+            }
+            else if (p_count > 0)
+                first = (static_cast<U64>(bytes[0]) << 16) | (static_cast<U64>(bytes[p_count >> 1]) << 8) | bytes[p_count - 1];
+        }
+        else
+        {
+            auto remaining = p_count;
+            if (remaining > 48)
+            {
+                auto second_seed = seed;
+                auto third_seed = seed;
+                do
+                {
+                    seed = hash_mix(read_64(bytes) ^ HASH_SECRETS[1], read_64(bytes + 8) ^ seed);
+                    second_seed = hash_mix(read_64(bytes + 16) ^ HASH_SECRETS[2], read_64(bytes + 24) ^ second_seed);
+                    third_seed = hash_mix(read_64(bytes + 32) ^ HASH_SECRETS[3], read_64(bytes + 40) ^ third_seed);
+                    bytes += 48;
+                    remaining -= 48;
+                } while (remaining > 48);
+                seed ^= second_seed ^ third_seed;
+            }
+            while (remaining > 16)
+            {
+                seed = hash_mix(read_64(bytes) ^ HASH_SECRETS[1], read_64(bytes + 8) ^ seed);
+                bytes += 16;
+                remaining -= 16;
+            }
+            first = read_64(bytes + remaining - 16);
+            second = read_64(bytes + remaining - 8);
+        }
+
+        const auto product = static_cast<__uint128_t>(first ^ HASH_SECRETS[1]) * (second ^ seed);
+        return hash_mix(static_cast<U64>(product) ^ HASH_SECRETS[0] ^ p_count, static_cast<U64>(product >> 64) ^ HASH_SECRETS[1]);
+    }
+
+    template <IsInteger T>
+    constexpr auto hash(T p_value) -> U64
+    {
+        auto mixed = static_cast<U64>(p_value);
+        mixed ^= mixed >> 33;
+        mixed *= 0xff51afd7ed558ccdull;
+        mixed ^= mixed >> 33;
+        mixed *= 0xc4ceb9fe1a85ec53ull;
+        mixed ^= mixed >> 33;
+        return mixed;
+    }
+
+    template <class T>
+    concept IsHashAvailable = requires(const T &p_object) {
+        {
+            hash(p_object)
+        } -> IsSame<U64>;
+    };
+
     template <class T, class W = T>
     concept IsSliceAvailable = IsKeyTypeAvailable<T> && requires(const T &p_object, const T::KeyType &p_begin, const T::KeyType &p_end) {
         {
@@ -346,6 +488,20 @@ namespace Rong
         } -> IsSame<T>;
     };
 
+    template <class T>
+    concept IsJumpAvailable = requires(T &p_object, I64 p_offset) {
+        {
+            p_object += p_offset
+        } -> IsSame<T>;
+    };
+
+    template <class T>
+    concept IsDistanceAvailable = requires(const T &p_left, const T &p_right) {
+        {
+            p_left - p_right
+        } -> IsSame<I64>;
+    };
+
     template <class T>
     concept IsContainsAvailable = IsValueTypeAvailable<T> && requires(const T &p_object, const T::ValueType &p_thing) {
         {
@@ -508,6 +664,13 @@ namespace Rong
         IsBidirectionalIterator<T, R> &&
         IsIndexAvailable<T, R>;
 
+    /// Iterator that jumps by any offset and measures the distance to another in O(1), so a range of it splits without walking.
+    template <class T, class R = const typename T::ValueType &>
+    concept IsSplittableIterator =
+        IsForwardIterator<T, R> &&
+        IsJumpAvailable<T> &&
+        IsDistanceAvailable<T>;
+
     template <class T, class R = const typename T::ValueType &>
     concept IsIteratorAvailable = requires(const T &p_object) {
         {
@@ -534,12 +697,8 @@ namespace Rong
         requires IsForwardIterator<T, R> && IsFunction<void, C, Size, R>
     constexpr auto for_each(C &&p_callable, T p_begin, T p_end, Size p_index = 0) -> void
     {
-        if constexpr (p_begin != p_end)
-        {
+        for (; !(p_begin == p_end); ++p_begin, ++p_index)
             p_callable(p_index, *p_begin);
-            ++p_begin;
-            for_each(forward<C>(p_callable), p_begin, p_end, p_index + 1);
-        }
     }
 
 } // namespace Rong
@@ -0,0 +1,175 @@
+#ifndef RG_CORE_FROZEN_BINARY_TREE_HPP
+#define RG_CORE_FROZEN_BINARY_TREE_HPP
+
+#include "def.hpp"
+#include "exception.hpp"
+#include "allocator.hpp"
+#include "list.hpp"
+
+namespace Rong
+{
+    /// Read-only search tree stored implicitly in breadth-first (Eytzinger) order.
+    template <IsConstrastAvailable K, class V, template <class E> class A = Allocator>
+        requires IsAllocatorFeaturesAvailable<A<X>, X>
+    class FrozenBinaryTree
+    {
+    public:
+        using KeyType = K;
+        using ValueType = V;
+        using ElementType = KeyType;
+        using KeyAllocator = A<KeyType>;
+        using ValueAllocator = A<ValueType>;
+
+        /// Descendant nodes covered by one prefetch: slot `PREFETCH_STRIDE * slot` begins the run of that many consecutive
+        /// descendants `log2(PREFETCH_STRIDE)` levels below `slot` (16 is four levels ahead), which fill about one cache line of keys.
+        static constexpr const Size PREFETCH_STRIDE = sizeof(KeyType) >= 64 ? 1 : (sizeof(KeyType) >= 32 ? 2 : (sizeof(KeyType) >= 16 ? 4 : (sizeof(KeyType) >= 8 ? 8 : 16)));
+
+    private:
+        KeyType *keys;
+        ValueType *values;
+        Size count;
+        Size cursor;
+
+        /// Eytzinger slot holding the smallest key.
+        constexpr auto first_slot() const -> Size
+        {
+            Size slot = 1;
+            while (slot * 2 <= count)
+                slot *= 2;
+            return slot;
+        }
+
+        /// Eytzinger slot holding the in-order successor of `p_slot`.
+        constexpr auto next_slot(Size p_slot) const -> Size
+        {
+            if (p_slot * 2 + 1 <= count)
+            {
+                p_slot = p_slot * 2 + 1;
+                while (p_slot * 2 <= count)
+                    p_slot *= 2;
+                return p_slot;
+            }
+            while (p_slot & 1)
+                p_slot >>= 1;
+            return p_slot >> 1;
+        }
+
+        auto allocate(Size p_count) -> void
+        {
+            count = p_count;
+            keys = KeyAllocator::allocate(count + 1);
+            values = ValueAllocator::allocate(count + 1);
+            cursor = count == 0 ? 0 : first_slot();
+        }
+
+        auto place(const KeyType &p_key, const ValueType &p_value) -> void
+        {
+            if (cursor == 0)
+                throw Exception<LOGICAL>("Frozen tree is already filled.");
+            keys[cursor] = p_key;
+            values[cursor] = p_value;
+            cursor = next_slot(cursor);
+        }
+
+        /// Branchless descent; returns the slot of the smallest key not less than `p_key`, or 0.
+        inline auto lower_bound(const KeyType &p_key) const -> Size
+        {
+            Size slot = 1;
+            while (slot <= count)
+            {
+                __builtin_prefetch(keys + PREFETCH_STRIDE * slot);
+                slot = 2 * slot + (contrast(keys[slot], p_key) < 0);
+            }
+            return slot >> __builtin_ffsll(~slot);
+        }
+
+    public:
+        FrozenBinaryTree() : keys(nullptr), values(nullptr), count(0), cursor(0) {}
+
+        FrozenBinaryTree(const ListView<KeyType> &p_keys, const ListView<ValueType> &p_values) : FrozenBinaryTree()
+        {
+            if (p_keys.get_count() != p_values.get_count())
+                throw Exception<LOGICAL>("Given keys and values differ in count.");
+
+            allocate(p_keys.get_count());
+            const auto key_data = p_keys.view_data();
+            const auto value_data = p_values.view_data();
+            for (Size i = 0; i < count; i++)
+            {
+                if (i != 0 && contrast(key_data[i - 1], key_data[i]) >= 0)
+                    throw Exception<LOGICAL>("Given keys are not sorted.");
+                place(key_data[i], value_data[i]);
+            }
+        }
+
+        /// Freezes any source whose `for_each` visits `p_count` elements in ascending key order.
+        template <class T>
+            requires IsForEachAvailable<T, Function<void, const KeyType &, const ValueType &>>
+        FrozenBinaryTree(const T &p_source, Size p_count) : FrozenBinaryTree()
+        {
+            allocate(p_count);
+            p_source.for_each([&](const KeyType &p_key, const ValueType &p_value)
+                              { place(p_key, p_value); });
+            if (cursor != 0)
+                throw Exception<LOGICAL>("Given element count does not match the source.");
+        }
+
+        FrozenBinaryTree(const FrozenBinaryTree &p_tree) = delete;
+        FrozenBinaryTree(FrozenBinaryTree &&p_tree) : keys(p_tree.keys), values(p_tree.values), count(p_tree.count), cursor(p_tree.cursor)
+        {
+            p_tree.keys = nullptr;
+            p_tree.values = nullptr;
+            p_tree.count = 0;
+            p_tree.cursor = 0;
+        }
+
+        ~FrozenBinaryTree()
+        {
+            if (keys != nullptr)
+            {
+                for (Size i = 1; i <= count; i++)
+                {
+                    keys[i].~KeyType();
+                    values[i].~ValueType();
+                }
+                KeyAllocator::deallocate(keys);
+                ValueAllocator::deallocate(values);
+            }
+            keys = nullptr;
+            values = nullptr;
+            count = 0;
+        }
+
+        inline auto get_count() const -> Size { return count; }
+
+        inline auto find(const KeyType &p_key) const -> const ValueType *
+        {
+            const auto slot = lower_bound(p_key);
+            if (slot == 0 || contrast(keys[slot], p_key) != 0)
+                return nullptr;
+            return values + slot;
+        }
+
+        inline auto contains(const KeyType &p_key) const -> B { return find(p_key) != nullptr; }
+
+        inline auto operator[](const KeyType &p_key) const -> const ValueType &
+        {
+            const auto found = find(p_key);
+            if (found == nullptr)
+                throw Exception<LOGICAL>("Given key is not in the tree.");
+            return *found;
+        }
+
+        template <class C>
+        auto for_each(const C &p_callable) const -> void
+        {
+            if (count == 0)
+                return;
+            for (auto slot = first_slot(); slot != 0; slot = next_slot(slot))
+                p_callable(keys[slot], values[slot]);
+        }
+    };
+
+} // namespace Rong
+
+#endif // RG_CORE_FROZEN_BINARY_TREE_HPP
\ No newline at end of file
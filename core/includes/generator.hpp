@@ -0,0 +1,127 @@
+#ifndef RG_CORE_GENERATOR_HPP
+#define RG_CORE_GENERATOR_HPP
+
+#include <coroutine>
+
+#include "def.hpp"
+#include "exception.hpp"
+#include "allocator.hpp"
+
+namespace Rong
+{
+    /// Lazily produced sequence: the coroutine runs only as far as the next `co_yield` each time the iterator advances.
+    /// Single pass; `cbegin` starts the coroutine, so it may only be called once.
+    template <class T, template <class E> class A = Allocator>
+        requires IsAllocatorFeaturesAvailable<A<X>, X>
+    class Generator
+    {
+    public:
+        using ValueType = T;
+        using ElementType = ValueType;
+        using FrameAllocator = A<U8>;
+
+        class promise_type
+        {
+        public:
+            const ValueType *current = nullptr;
+
+            /// Frames come from the library allocator so they can be pooled like any other allocation.
+            static auto operator new(decltype(sizeof(0)) p_size) -> void * { return FrameAllocator::allocate(p_size); }
+            static auto operator delete(void *p_frame) -> void { FrameAllocator::deallocate(static_cast<U8 *>(p_frame)); }
+
+            inline auto get_return_object() -> Generator { return Generator(std::coroutine_handle<promise_type>::from_promise(*this)); }
+            inline auto initial_suspend() const noexcept -> std::suspend_always { return {}; }
+            inline auto final_suspend() const noexcept -> std::suspend_always { return {}; }
+            inline auto return_void() -> void {}
+            inline auto unhandled_exception() -> void { throw; }
+
+            /// The yielded object lives until the coroutine is resumed, so pointing at it is enough.
+            inline auto yield_value(const ValueType &p_value) -> std::suspend_always
+            {
+                current = &p_value;
+                return {};
+            }
+        };
+
+        using HandleType = std::coroutine_handle<promise_type>;
+
+        class Iterator
+        {
+        public:
+            using ContainerType = Generator;
+            using ValueType = ContainerType::ValueType;
+
+        private:
+            HandleType handle;
+
+        public:
+            inline Iterator(HandleType p_handle) : handle(p_handle) {}
+            inline auto operator*() const -> const ValueType & { return *handle.promise().current; }
+            inline auto operator++() -> Iterator
+            {
+                handle.resume();
+                return *this;
+            }
+
+            /// A finished coroutine compares equal to the end iterator.
+            inline auto operator==(const Iterator &p_right) const -> B
+            {
+                const auto finished = handle == nullptr || handle.done();
+                const auto right_finished = p_right.handle == nullptr || p_right.handle.done();
+                if (finished || right_finished)
+                    return finished == right_finished;
+                return handle == p_right.handle;
+            }
+        };
+
+    private:
+        HandleType handle;
+
+        inline Generator(HandleType p_handle) : handle(p_handle) {}
+
+    public:
+        Generator(const Generator &p_generator) = delete;
+        Generator(Generator &&p_generator) : handle(p_generator.handle) { p_generator.handle = nullptr; }
+
+        ~Generator()
+        {
+            if (handle)
+                handle.destroy();
+            handle = nullptr;
+        }
+
+        auto operator=(Generator &&p_generator) -> Generator &
+        {
+            if (this == &p_generator)
+                return *this;
+            if (handle)
+                handle.destroy();
+            handle = p_generator.handle;
+            p_generator.handle = nullptr;
+            return *this;
+        }
+
+        auto cbegin() const -> Iterator
+        {
+            if (handle == nullptr)
+                throw Exception<LOGICAL>("Generator is empty.");
+            if (handle.done() || handle.promise().current != nullptr)
+                throw Exception<LOGICAL>("Generator has already been started.");
+            handle.resume();
+            return Iterator(handle);
+        }
+
+        inline auto cend() const -> Iterator { return Iterator(nullptr); }
+
+        template <class C>
+        inline auto for_each(const C &p_callable) const -> void { Rong::for_each(p_callable, cbegin(), cend()); }
+    };
+
+#ifdef FEATURE_ASSERTION
+    static_assert(IsForwardIterator<Generator<X>::Iterator>, "`Generator::Iterator` is malformed.");
+    static_assert(IsIteratorAvailable<Generator<X>>, "`Generator` iterator is malformed.");
+#endif // FEATURE_ASSERTION
+
+} // namespace Rong
+
+#endif // RG_CORE_GENERATOR_HPP
\ No newline at end of file
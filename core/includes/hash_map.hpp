@@ -0,0 +1,348 @@
+#ifndef RG_CORE_HASH_MAP_HPP
+#define RG_CORE_HASH_MAP_HPP
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "def.hpp"
+#include "exception.hpp"
+#include "allocator.hpp"
+#include "pair.hpp"
+
+namespace Rong
+{
+    /// Control bytes of `GROUP_SIZE` consecutive slots, matched all at once.
+    class HashMapGroup
+    {
+    public:
+        static constexpr const Size GROUP_SIZE = 16;
+        static constexpr const I8 EMPTY = -128;
+        static constexpr const I8 DELETED = -2;
+
+    private:
+#ifdef __SSE2__
+        __m128i controls;
+#else
+        const I8 *controls;
+#endif
+
+    public:
+#ifdef __SSE2__
+        inline HashMapGroup(const I8 *p_controls) : controls(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p_controls))) {}
+
+        /// Bit `i` is set when slot `i` holds `p_tag`.
+        inline auto match(I8 p_tag) const -> U32 { return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(p_tag), controls)); }
+        inline auto match_empty() const -> U32 { return match(EMPTY); }
+        inline auto match_free() const -> U32 { return _mm_movemask_epi8(controls); }
+#else
+        inline HashMapGroup(const I8 *p_controls) : controls(p_controls) {}
+
+        inline auto match(I8 p_tag) const -> U32
+        {
+            U32 mask = 0;
+            for (Size i = 0; i < GROUP_SIZE; i++)
+                mask |= static_cast<U32>(controls[i] == p_tag) << i;
+            return mask;
+        }
+        inline auto match_empty() const -> U32 { return match(EMPTY); }
+        inline auto match_free() const -> U32
+        {
+            U32 mask = 0;
+            for (Size i = 0; i < GROUP_SIZE; i++)
+                mask |= static_cast<U32>(controls[i] < 0) << i;
+            return mask;
+        }
+#endif
+    };
+
+    /// Open-addressing hash map probing whole groups of control bytes, in the style of a Swiss table.
+    template <IsHashAvailable K, class V, template <class E> class A = Allocator>
+        requires IsConstrastAvailable<K> && IsAllocatorFeaturesAvailable<A<X>, X>
+    class HashMap
+    {
+    public:
+        using KeyType = K;
+        using ValueType = V;
+        using ElementType = Pair<const KeyType &, const ValueType &>;
+        using ControlAllocator = A<I8>;
+        using KeyAllocator = A<KeyType>;
+        using ValueAllocator = A<ValueType>;
+        static constexpr const Size GROUP_SIZE = HashMapGroup::GROUP_SIZE;
+        static constexpr const Size INITIAL_CAPACITY = GROUP_SIZE;
+
+        class Iterator
+        {
+        public:
+            using ContainerType = HashMap;
+            using ValueType = ContainerType::ElementType;
+
+        private:
+            const ContainerType &container;
+            Size index;
+
+            inline auto skip() -> void
+            {
+                while (index < container.capacity && container.controls[index] < 0)
+                    index++;
+            }
+
+        public:
+            inline Iterator(const ContainerType &p_container, Size p_index) : container(p_container), index(p_index) { skip(); }
+            inline auto operator*() const -> ValueType { return ValueType(container.keys[index], container.values[index]); }
+            inline auto operator++() -> Iterator
+            {
+                index++;
+                skip();
+                return *this;
+            }
+            inline auto operator==(const Iterator &p_right) const -> B { return &container == &p_right.container && index == p_right.index; }
+        };
+
+    private:
+        I8 *controls;
+        KeyType *keys;
+        ValueType *values;
+        Size count;
+        Size capacity;
+        Size growth_left;
+
+        static inline auto get_tag(U64 p_hash) -> I8 { return static_cast<I8>(p_hash & 0x7F); }
+        static inline auto get_growth_limit(Size p_capacity) -> Size { return p_capacity - p_capacity / 8; }
+
+        /// Keeps the bytes past the end mirroring the first group, so a group load never wraps.
+        inline auto set_control(Size p_index, I8 p_control) -> void
+        {
+            controls[p_index] = p_control;
+            if (p_index < GROUP_SIZE)
+                controls[capacity + p_index] = p_control;
+        }
+
+        auto find_index(const KeyType &p_key) const -> Size
+        {
+            if (capacity == 0)
+                return capacity;
+
+            const auto key_hash = hash(p_key);
+            const auto tag = get_tag(key_hash);
+            const auto mask = capacity - 1;
+            auto position = (key_hash >> 7) & mask;
+            for (Size probe = 1; true; probe++)
+            {
+                const auto group = HashMapGroup(controls + position);
+                for (auto matched = group.match(tag); matched != 0; matched &= matched - 1)
+                {
+                    const auto index = (position + __builtin_ctz(matched)) & mask;
+                    if (contrast(keys[index], p_key) == 0)
+                        return index;
+                }
+                if (group.match_empty() != 0)
+                    return capacity;
+                position = (position + probe * GROUP_SIZE) & mask;
+            }
+        }
+
+        auto find_free_index(U64 p_hash) const -> Size
+        {
+            const auto mask = capacity - 1;
+            auto position = (p_hash >> 7) & mask;
+            for (Size probe = 1; true; probe++)
+            {
+                const auto matched = HashMapGroup(controls + position).match_free();
+                if (matched != 0)
+                    return (position + __builtin_ctz(matched)) & mask;
+                position = (position + probe * GROUP_SIZE) & mask;
+            }
+        }
+
+        auto rehash(Size p_capacity) -> void
+        {
+            auto old_controls = controls;
+            auto old_keys = keys;
+            auto old_values = values;
+            const auto old_capacity = capacity;
+
+            controls = ControlAllocator::allocate(p_capacity + GROUP_SIZE);
+            keys = KeyAllocator::allocate(p_capacity);
+            values = ValueAllocator::allocate(p_capacity);
+            capacity = p_capacity;
+            growth_left = get_growth_limit(capacity) - count;
+            for (Size i = 0; i < capacity + GROUP_SIZE; i++)
+                controls[i] = HashMapGroup::EMPTY;
+
+            if (old_controls == nullptr)
+                return;
+
+            for (Size i = 0; i < old_capacity; i++)
+            {
+                if (old_controls[i] < 0)
+                    continue;
+                const auto key_hash = hash(old_keys[i]);
+                const auto index = find_free_index(key_hash);
+                set_control(index, get_tag(key_hash));
+                keys[index] = move(old_keys[i]);
+                values[index] = move(old_values[i]);
+                old_keys[i].~KeyType();
+                old_values[i].~ValueType();
+            }
+
+            ControlAllocator::deallocate(old_controls);
+            KeyAllocator::deallocate(old_keys);
+            ValueAllocator::deallocate(old_values);
+        }
+
+    public:
+        HashMap() : controls(nullptr), keys(nullptr), values(nullptr), count(0), capacity(0), growth_left(0) {}
+
+        HashMap(const HashMap &p_map) : HashMap()
+        {
+            reserve(p_map.count);
+            p_map.for_each([&](const KeyType &p_key, const ValueType &p_value)
+                           { set(p_key, p_value); });
+        }
+
+        HashMap(HashMap &&p_map) : controls(p_map.controls), keys(p_map.keys), values(p_map.values), count(p_map.count), capacity(p_map.capacity), growth_left(p_map.growth_left)
+        {
+            p_map.controls = nullptr;
+            p_map.keys = nullptr;
+            p_map.values = nullptr;
+            p_map.count = 0;
+            p_map.capacity = 0;
+            p_map.growth_left = 0;
+        }
+
+        ~HashMap()
+        {
+            clean();
+        }
+
+        inline auto get_count() const -> Size { return count; }
+        inline auto get_capacity() const -> Size { return capacity; }
+
+        inline auto cbegin() const -> Iterator { return Iterator(*this, 0); }
+        inline auto cend() const -> Iterator { return Iterator(*this, capacity); }
+
+        inline auto find(const KeyType &p_key) -> ValueType *
+        {
+            const auto index = find_index(p_key);
+            return index == capacity ? nullptr : values + index;
+        }
+
+        inline auto find(const KeyType &p_key) const -> const ValueType * { return const_cast<HashMap *>(this)->find(p_key); }
+        inline auto contains(const KeyType &p_key) const -> B { return find(p_key) != nullptr; }
+
+        inline auto operator[](const KeyType &p_key) -> ValueType &
+        {
+            const auto found = find(p_key);
+            if (found == nullptr)
+                throw Exception<LOGICAL>("Given key is not in the map.");
+            return *found;
+        }
+
+        inline auto operator[](const KeyType &p_key) const -> const ValueType &
+        {
+            const auto found = find(p_key);
+            if (found == nullptr)
+                throw Exception<LOGICAL>("Given key is not in the map.");
+            return *found;
+        }
+
+        /// Makes room for `p_min_count` elements without further rehashing.
+        auto reserve(Size p_min_count) -> void
+        {
+            auto new_capacity = capacity == 0 ? INITIAL_CAPACITY : capacity;
+            while (get_growth_limit(new_capacity) < p_min_count)
+                new_capacity *= 2;
+            if (new_capacity != capacity)
+                rehash(new_capacity);
+        }
+
+        auto set(const KeyType &p_key, const ValueType &p_value) -> void
+        {
+            const auto found = find_index(p_key);
+            if (found != capacity)
+            {
+                values[found] = p_value;
+                return;
+            }
+
+            if (growth_left == 0)
+            {
+                // Grow only when tombstones are not what fills the table.
+                if (capacity == 0)
+                    rehash(INITIAL_CAPACITY);
+                else if (count * 2 < get_growth_limit(capacity))
+                    rehash(capacity);
+                else
+                    rehash(capacity * 2);
+            }
+
+            const auto key_hash = hash(p_key);
+            const auto index = find_free_index(key_hash);
+            if (controls[index] == HashMapGroup::EMPTY)
+                growth_left--;
+            set_control(index, get_tag(key_hash));
+            keys[index] = p_key;
+            values[index] = p_value;
+            count++;
+        }
+
+        auto remove(const KeyType &p_key) -> ValueType
+        {
+            const auto index = find_index(p_key);
+            if (index == capacity)
+                throw Exception<LOGICAL>("Given key is not in the map.");
+
+            auto removed = move(values[index]);
+            keys[index].~KeyType();
+            values[index].~ValueType();
+            set_control(index, HashMapGroup::DELETED);
+            count--;
+            return removed;
+        }
+
+        template <class C>
+        auto for_each(const C &p_callable) const -> void
+        {
+            for (Size i = 0; i < capacity; i++)
+                if (controls[i] >= 0)
+                    p_callable(keys[i], values[i]);
+        }
+
+        auto clean() -> void
+        {
+            if (controls != nullptr)
+            {
+                for (Size i = 0; i < capacity; i++)
+                {
+                    if (controls[i] < 0)
+                        continue;
+                    keys[i].~KeyType();
+                    values[i].~ValueType();
+                }
+                ControlAllocator::deallocate(controls);
+                KeyAllocator::deallocate(keys);
+                ValueAllocator::deallocate(values);
+            }
+            controls = nullptr;
+            keys = nullptr;
+            values = nullptr;
+            count = 0;
+            capacity = 0;
+            growth_left = 0;
+        }
+    };
+
+#ifdef FEATURE_ASSERTION
+    static_assert(IsForwardIterator<HashMap<U, X>::Iterator, HashMap<U, X>::ElementType>, "`HashMap::Iterator` is malformed.");
+    static_assert(IsIteratorAvailable<HashMap<U, X>, HashMap<U, X>::ElementType>, "`HashMap` iterator is malformed.");
+    static_assert(IsSetAvailable<HashMap<U, X>>, "`HashMap::set` is malformed.");
+    static_assert(IsRemoveAvailable<HashMap<U, X>>, "`HashMap::remove` is malformed.");
+    static_assert(IsReserveAvailable<HashMap<U, X>>, "`HashMap::reserve` is malformed.");
+    static_assert(IsCleanAvailable<HashMap<U, X>>, "`HashMap::clean` is malformed.");
+    static_assert(IsCountAvailable<HashMap<U, X>>, "`HashMap::get_count` is malformed.");
+#endif // FEATURE_ASSERTION
+
+} // namespace Rong
+
+#endif // RG_CORE_HASH_MAP_HPP
\ No newline at end of file
@@ -0,0 +1,168 @@
+#ifndef RG_CORE_INTERNER_HPP
+#define RG_CORE_INTERNER_HPP
+
+#include <string.h>
+
+#include "def.hpp"
+#include "exception.hpp"
+#include "allocator.hpp"
+#include "list.hpp"
+#include "lock.hpp"
+#include "hash_map.hpp"
+#include "string.hpp"
+
+namespace Rong
+{
+    /// Handle to a string owned by a `StringInterner`. Equal strings from the same interner get equal handles,
+    /// so equality, `contrast` and `hash` are O(1); the order `contrast` gives is arbitrary but stable.
+    class Symbol
+    {
+    public:
+        U32 id;
+
+        constexpr auto operator==(const Symbol &p_right) const -> B { return id == p_right.id; }
+    };
+
+    constexpr auto contrast(const Symbol &p_left, const Symbol &p_right) -> I
+    {
+        return p_left.id < p_right.id ? -1 : p_left.id > p_right.id ? 1
+                                                                    : 0;
+    }
+
+    inline auto hash(const Symbol &p_symbol) -> U64 { return hash(p_symbol.id); }
+
+    /// Stores each distinct string once, in arena chunks that never move, and maps it to a 32-bit `Symbol`.
+    /// Strings are spread over independently locked shards by hash, so concurrent interning of different strings rarely contends.
+    template <template <class E> class A = Allocator, Size ShardBits = 4>
+        requires IsAllocatorFeaturesAvailable<A<X>, X>
+    class StringInterner
+    {
+    public:
+        using CharacterAllocator = A<C>;
+        static constexpr const Size SHARD_COUNT = static_cast<Size>(1) << ShardBits;
+        static constexpr const Size CHUNK_SIZE = 64 * 1024;
+        /// The low id bits name the shard, the rest index into it.
+        static constexpr const Size SHARD_CAPACITY = static_cast<Size>(1) << (32 - ShardBits);
+
+        static_assert(ShardBits > 0 && ShardBits < 16, "Shard bits must leave room for per-shard indices.");
+
+    private:
+        class alignas(CACHE_LINE_SIZE) Shard
+        {
+        public:
+            mutable ReadWriteLock lock;
+            HashMap<StringView, U32, A> indices;
+            List<StringView, A> strings;
+            List<C *, A> chunks;
+            Size chunk_used = 0;
+            Size chunk_capacity = 0;
+
+            /// Copies `p_text` into the arena. Strings larger than a chunk get one of their own and leave the current chunk open.
+            auto store(const StringView &p_text) -> StringView
+            {
+                const auto count = p_text.get_count();
+                if (count == 0)
+                    return StringView();
+
+                C *target = nullptr;
+                if (count > CHUNK_SIZE)
+                {
+                    target = CharacterAllocator::allocate(count);
+                    chunks.append(target);
+                }
+                else
+                {
+                    if (chunk_used + count > chunk_capacity)
+                    {
+                        chunks.append(CharacterAllocator::allocate(CHUNK_SIZE));
+                        chunk_used = 0;
+                        chunk_capacity = CHUNK_SIZE;
+                    }
+                    target = chunks[chunks.get_count() - 1] + chunk_used;
+                    chunk_used += count;
+                }
+                memcpy(target, p_text.view_data(), count);
+                return StringView(target, count);
+            }
+
+            ~Shard()
+            {
+                for (Size i = 0; i < chunks.get_count(); i++)
+                    CharacterAllocator::deallocate(chunks[i]);
+            }
+        };
+
+        Shard shards[SHARD_COUNT];
+
+        inline auto get_shard_index(const StringView &p_text) const -> Size { return hash(p_text) >> (64 - ShardBits); }
+
+    public:
+        StringInterner() = default;
+        StringInterner(const StringInterner &p_interner) = delete;
+        StringInterner(StringInterner &&p_interner) = delete;
+
+        /// Returns the existing handle for `p_text`, or stores a copy and hands out a new one.
+        auto intern(const StringView &p_text) -> Symbol
+        {
+            const auto shard_index = get_shard_index(p_text);
+            auto &shard = shards[shard_index];
+            {
+                auto guard = ReadGuard(shard.lock);
+                const auto found = shard.indices.find(p_text);
+                if (found != nullptr)
+                    return Symbol{static_cast<U32>(*found << ShardBits | shard_index)};
+            }
+
+            auto guard = WriteGuard(shard.lock);
+            const auto found = shard.indices.find(p_text);
+            if (found != nullptr)
+                return Symbol{static_cast<U32>(*found << ShardBits | shard_index)};
+            const auto index = shard.strings.get_count();
+            if (index >= SHARD_CAPACITY)
+                throw Exception<RUNTIME>("String interner has run out of handles.");
+
+            const auto stored = shard.store(p_text);
+            shard.strings.append(stored);
+            shard.indices.set(stored, static_cast<U32>(index));
+            return Symbol{static_cast<U32>(index << ShardBits | shard_index)};
+        }
+
+        /// Looks `p_text`, e.g. a `ListView<C>` into an input buffer, up without storing it.
+        auto find(const StringView &p_text, Symbol &p_symbol) const -> B
+        {
+            const auto shard_index = get_shard_index(p_text);
+            auto &shard = shards[shard_index];
+            auto guard = ReadGuard(shard.lock);
+            const auto found = shard.indices.find(p_text);
+            if (found == nullptr)
+                return false;
+            p_symbol = Symbol{static_cast<U32>(*found << ShardBits | shard_index)};
+            return true;
+        }
+
+        /// The interned characters, valid for the interner's lifetime.
+        auto view(const Symbol &p_symbol) const -> StringView
+        {
+            auto &shard = shards[p_symbol.id & (SHARD_COUNT - 1)];
+            const auto index = p_symbol.id >> ShardBits;
+            auto guard = ReadGuard(shard.lock);
+            if (index >= shard.strings.get_count())
+                throw Exception<LOGICAL>("Given symbol does not belong to this interner.");
+            return shard.strings[index];
+        }
+
+        auto get_count() const -> Size
+        {
+            Size count = 0;
+            for (auto &shard : shards)
+            {
+                auto guard = ReadGuard(shard.lock);
+                count += shard.strings.get_count();
+            }
+            return count;
+        }
+    };
+
+} // namespace Rong
+
+#endif // RG_CORE_INTERNER_HPP
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include "def.hpp"
 #include "exception.hpp"
 #include "pair.hpp"
+#include "tuple.hpp"
 
 namespace Rong
 {
@@ -54,6 +55,23 @@ namespace Rong
         constexpr IteratorWrapper(const T &p_begin_iterator, const T &p_end_iterator) : begin_iterator(p_begin_iterator), end_iterator(p_end_iterator) {}
         constexpr auto cbegin() const -> T { return begin_iterator; }
         constexpr auto cend() const -> T { return end_iterator; }
+
+        constexpr auto get_count() const -> Size
+            requires IsSplittableIterator<T, R>
+        {
+            return end_iterator - begin_iterator;
+        }
+
+        /// The first `p_index` elements and the rest, without walking either.
+        constexpr auto split_at(Size p_index) const -> Pair<IteratorWrapper, IteratorWrapper>
+            requires IsSplittableIterator<T, R>
+        {
+            if (p_index > get_count())
+                throw Exception<LOGICAL>("Given index is beyond range's element count.");
+            auto middle = begin_iterator;
+            middle += static_cast<I64>(p_index);
+            return Pair<IteratorWrapper, IteratorWrapper>(IteratorWrapper(begin_iterator, middle), IteratorWrapper(middle, end_iterator));
+        }
     };
 
     template <class T, class R = typename T::ValueType &>
@@ -71,6 +89,35 @@ namespace Rong
         constexpr AccessibleIteratorWrapper(const T &p_begin_iterator, const T &p_end_iterator) : begin_iterator(p_begin_iterator), end_iterator(p_end_iterator) {}
         constexpr auto begin() const -> T { return begin_iterator; }
         constexpr auto end() const -> T { return end_iterator; }
+
+        constexpr auto get_count() const -> Size
+            requires IsSplittableIterator<T, R>
+        {
+            return end_iterator - begin_iterator;
+        }
+
+        /// The first `p_index` elements and the rest, without walking either.
+        constexpr auto split_at(Size p_index) const -> Pair<AccessibleIteratorWrapper, AccessibleIteratorWrapper>
+            requires IsSplittableIterator<T, R>
+        {
+            if (p_index > get_count())
+                throw Exception<LOGICAL>("Given index is beyond range's element count.");
+            auto middle = begin_iterator;
+            middle += static_cast<I64>(p_index);
+            return Pair<AccessibleIteratorWrapper, AccessibleIteratorWrapper>(AccessibleIteratorWrapper(begin_iterator, middle), AccessibleIteratorWrapper(middle, end_iterator));
+        }
+    };
+
+    /// Range that counts its elements and splits into two adjacent ranges in O(1), for partitioning work across threads or chunks.
+    template <class T>
+    concept IsSplittableRange = requires(const T &p_object, Size p_index) {
+        {
+            p_object.get_count()
+        } -> IsSame<Size>;
+
+        {
+            p_object.split_at(p_index)
+        } -> IsSame<Pair<T, T>>;
     };
 
     template <class T, class R = const typename T::ValueType &>
@@ -94,6 +141,18 @@ namespace Rong
             return *this;
         }
         constexpr auto operator==(const EnumerateIterator &p_right) const -> B { return iterator == p_right.iterator; }
+        constexpr auto operator+=(I64 p_offset) -> EnumerateIterator
+            requires IsJumpAvailable<T>
+        {
+            iterator += p_offset;
+            index += p_offset;
+            return *this;
+        }
+        constexpr auto operator-(const EnumerateIterator &p_right) const -> I64
+            requires IsDistanceAvailable<T>
+        {
+            return iterator - p_right.iterator;
+        }
     };
 
     template <class T, class R = const typename T::ValueType &>
@@ -124,6 +183,18 @@ namespace Rong
             return *this;
         }
         inline auto operator==(const AccessibleEnumerateIterator &p_right) const -> B { return iterator == p_right.iterator; }
+        inline auto operator+=(I64 p_offset) -> AccessibleEnumerateIterator
+            requires IsJumpAvailable<T>
+        {
+            iterator += p_offset;
+            index += p_offset;
+            return *this;
+        }
+        inline auto operator-(const AccessibleEnumerateIterator &p_right) const -> I64
+            requires IsDistanceAvailable<T>
+        {
+            return iterator - p_right.iterator;
+        }
     };
 
     template <class T, class R = typename T::ValueType &>
@@ -154,6 +225,21 @@ namespace Rong
             return *this;
         }
         constexpr auto operator==(const ZipIterator &p_right) const -> B { return first == p_right.first || second == p_right.second; }
+        constexpr auto operator+=(I64 p_offset) -> ZipIterator
+            requires IsJumpAvailable<T> && IsJumpAvailable<W>
+        {
+            first += p_offset;
+            second += p_offset;
+            return *this;
+        }
+        /// Distance of the shorter sequence, matching where iteration stops.
+        constexpr auto operator-(const ZipIterator &p_right) const -> I64
+            requires IsDistanceAvailable<T> && IsDistanceAvailable<W>
+        {
+            const auto first_distance = first - p_right.first;
+            const auto second_distance = second - p_right.second;
+            return first_distance < second_distance ? first_distance : second_distance;
+        }
     };
 
     template <class T, class W, class R = const typename T::ValueType &, class S = const typename W::ValueType &>
@@ -194,6 +280,21 @@ namespace Rong
             return *this;
         }
         inline auto operator==(const AccessibleZipIterator &p_right) const -> B { return first == p_right.first || second == p_right.second; }
+        inline auto operator+=(I64 p_offset) -> AccessibleZipIterator
+            requires IsJumpAvailable<T> && IsJumpAvailable<W>
+        {
+            first += p_offset;
+            second += p_offset;
+            return *this;
+        }
+        /// Distance of the shorter sequence, matching where iteration stops.
+        inline auto operator-(const AccessibleZipIterator &p_right) const -> I64
+            requires IsDistanceAvailable<T> && IsDistanceAvailable<W>
+        {
+            const auto first_distance = first - p_right.first;
+            const auto second_distance = second - p_right.second;
+            return first_distance < second_distance ? first_distance : second_distance;
+        }
     };
 
     template <class T, class W, class R = typename T::ValueType &, class S = typename W::ValueType &>
@@ -213,6 +314,135 @@ namespace Rong
         return accessible_zip(p_first_iterable.begin(), p_first_iterable.end(), p_second_iterable.begin(), p_second_iterable.end());
     }
 
+    /// Walks any number of sequences in lockstep, yielding a `Tuple` of references into each; stops at the shortest.
+    template <class... T>
+        requires(sizeof...(T) > 1 && (IsForwardIterator<T> && ...))
+    class MultiZipIterator
+    {
+    public:
+        using ValueType = Tuple<const typename T::ValueType &...>;
+
+    private:
+        Tuple<T...> iterators;
+
+        template <Size... Index>
+        constexpr auto dereference(IndexSequence<Index...>) const -> ValueType { return ValueType(*iterators.template get<Index>()...); }
+
+        template <Size... Index>
+        constexpr auto advance(IndexSequence<Index...>) -> void { (++iterators.template get<Index>(), ...); }
+
+        template <Size... Index>
+        constexpr auto meets(const MultiZipIterator &p_right, IndexSequence<Index...>) const -> B { return ((iterators.template get<Index>() == p_right.iterators.template get<Index>()) || ...); }
+
+        template <Size... Index>
+        constexpr auto jump(I64 p_offset, IndexSequence<Index...>) -> void { ((iterators.template get<Index>() += p_offset), ...); }
+
+        template <Size... Index>
+        constexpr auto distance(const MultiZipIterator &p_right, IndexSequence<Index...>) const -> I64
+        {
+            const I64 distances[] = {(iterators.template get<Index>() - p_right.iterators.template get<Index>())...};
+            auto shortest = distances[0];
+            for (auto distance : distances)
+                if (distance < shortest)
+                    shortest = distance;
+            return shortest;
+        }
+
+    public:
+        constexpr MultiZipIterator(const T &...p_iterators) : iterators(p_iterators...) {}
+        constexpr auto operator*() const -> ValueType { return dereference(MakeIndexSequence<sizeof...(T)>()); }
+        constexpr auto operator++() -> MultiZipIterator
+        {
+            advance(MakeIndexSequence<sizeof...(T)>());
+            return *this;
+        }
+        constexpr auto operator==(const MultiZipIterator &p_right) const -> B { return meets(p_right, MakeIndexSequence<sizeof...(T)>()); }
+        constexpr auto operator+=(I64 p_offset) -> MultiZipIterator
+            requires(IsJumpAvailable<T> && ...)
+        {
+            jump(p_offset, MakeIndexSequence<sizeof...(T)>());
+            return *this;
+        }
+        /// Distance of the shortest sequence, matching where iteration stops.
+        constexpr auto operator-(const MultiZipIterator &p_right) const -> I64
+            requires(IsDistanceAvailable<T> && ...)
+        {
+            return distance(p_right, MakeIndexSequence<sizeof...(T)>());
+        }
+    };
+
+    template <class... T>
+        requires(sizeof...(T) > 2 && (IsIteratorAvailable<T> && ...))
+    constexpr auto zip(const T &...p_iterables)
+    {
+        using Iterator = MultiZipIterator<decltype(p_iterables.cbegin())...>;
+        return IteratorWrapper<Iterator, typename Iterator::ValueType>(Iterator(p_iterables.cbegin()...), Iterator(p_iterables.cend()...));
+    }
+
+    template <class... T>
+        requires(sizeof...(T) > 1 && (IsForwardIterator<T, typename T::ValueType &> && ...))
+    class AccessibleMultiZipIterator
+    {
+    public:
+        using ValueType = Tuple<typename T::ValueType &...>;
+
+    private:
+        Tuple<T...> iterators;
+
+        template <Size... Index>
+        inline auto dereference(IndexSequence<Index...>) -> ValueType { return ValueType(*iterators.template get<Index>()...); }
+
+        template <Size... Index>
+        inline auto advance(IndexSequence<Index...>) -> void { (++iterators.template get<Index>(), ...); }
+
+        template <Size... Index>
+        inline auto meets(const AccessibleMultiZipIterator &p_right, IndexSequence<Index...>) const -> B { return ((iterators.template get<Index>() == p_right.iterators.template get<Index>()) || ...); }
+
+        template <Size... Index>
+        inline auto jump(I64 p_offset, IndexSequence<Index...>) -> void { ((iterators.template get<Index>() += p_offset), ...); }
+
+        template <Size... Index>
+        inline auto distance(const AccessibleMultiZipIterator &p_right, IndexSequence<Index...>) const -> I64
+        {
+            const I64 distances[] = {(iterators.template get<Index>() - p_right.iterators.template get<Index>())...};
+            auto shortest = distances[0];
+            for (auto distance : distances)
+                if (distance < shortest)
+                    shortest = distance;
+            return shortest;
+        }
+
+    public:
+        inline AccessibleMultiZipIterator(const T &...p_iterators) : iterators(p_iterators...) {}
+        inline auto operator*() -> ValueType { return dereference(MakeIndexSequence<sizeof...(T)>()); }
+        inline auto operator++() -> AccessibleMultiZipIterator
+        {
+            advance(MakeIndexSequence<sizeof...(T)>());
+            return *this;
+        }
+        inline auto operator==(const AccessibleMultiZipIterator &p_right) const -> B { return meets(p_right, MakeIndexSequence<sizeof...(T)>()); }
+        inline auto operator+=(I64 p_offset) -> AccessibleMultiZipIterator
+            requires(IsJumpAvailable<T> && ...)
+        {
+            jump(p_offset, MakeIndexSequence<sizeof...(T)>());
+            return *this;
+        }
+        /// Distance of the shortest sequence, matching where iteration stops.
+        inline auto operator-(const AccessibleMultiZipIterator &p_right) const -> I64
+            requires(IsDistanceAvailable<T> && ...)
+        {
+            return distance(p_right, MakeIndexSequence<sizeof...(T)>());
+        }
+    };
+
+    template <class... T>
+        requires(sizeof...(T) > 2 && (IsIteratorAccessible<T> && ...))
+    inline auto accessible_zip(T &...p_iterables)
+    {
+        using Iterator = AccessibleMultiZipIterator<decltype(p_iterables.begin())...>;
+        return AccessibleIteratorWrapper<Iterator, typename Iterator::ValueType>(Iterator(p_iterables.begin()...), Iterator(p_iterables.end()...));
+    }
+
     template <class T, class R = const typename T::ValueType &>
         requires IsBidirectionalIterator<T, R>
     class ReverseIterator
@@ -232,6 +462,17 @@ namespace Rong
             return *this;
         }
         constexpr auto operator==(const ReverseIterator &p_right) const -> B { return iterator == p_right.iterator; }
+        constexpr auto operator+=(I64 p_offset) -> ReverseIterator
+            requires IsJumpAvailable<T>
+        {
+            iterator += -p_offset;
+            return *this;
+        }
+        constexpr auto operator-(const ReverseIterator &p_right) const -> I64
+            requires IsDistanceAvailable<T>
+        {
+            return p_right.iterator - iterator;
+        }
     };
 
     template <class T, class R = const typename T::ValueType &>
@@ -261,6 +502,17 @@ namespace Rong
             return *this;
         }
         inline auto operator==(const AccessibleReverseIterator &p_right) const -> B { return iterator == p_right.iterator; }
+        inline auto operator+=(I64 p_offset) -> AccessibleReverseIterator
+            requires IsJumpAvailable<T>
+        {
+            iterator += -p_offset;
+            return *this;
+        }
+        inline auto operator-(const AccessibleReverseIterator &p_right) const -> I64
+            requires IsDistanceAvailable<T>
+        {
+            return p_right.iterator - iterator;
+        }
     };
 
     template <class T, class R = typename T::ValueType &>
@@ -280,8 +532,11 @@ namespace Rong
     static_assert(IsForwardIterator<AccessibleEnumerateIterator<AccessibleDummyIterator<X>>, typename AccessibleEnumerateIterator<AccessibleDummyIterator<X>>::ValueType>, "`AccessibleEnumerateIterator` is malformed.");
     static_assert(IsForwardIterator<ZipIterator<DummyIterator<X>, DummyIterator<Y>>, typename ZipIterator<DummyIterator<X>, DummyIterator<Y>>::ValueType>, "`EnumerateIterator` is malformed.");
     static_assert(IsForwardIterator<AccessibleZipIterator<AccessibleDummyIterator<X>, AccessibleDummyIterator<Y>>, typename AccessibleZipIterator<AccessibleDummyIterator<X>, AccessibleDummyIterator<Y>>::ValueType>, "`EnumerateIterator` is malformed.");
+    static_assert(IsForwardIterator<MultiZipIterator<DummyIterator<X>, DummyIterator<Y>>, typename MultiZipIterator<DummyIterator<X>, DummyIterator<Y>>::ValueType>, "`MultiZipIterator` is malformed.");
+    static_assert(IsForwardIterator<AccessibleMultiZipIterator<AccessibleDummyIterator<X>, AccessibleDummyIterator<Y>>, typename AccessibleMultiZipIterator<AccessibleDummyIterator<X>, AccessibleDummyIterator<Y>>::ValueType>, "`AccessibleMultiZipIterator` is malformed.");
     static_assert(IsForwardIterator<ReverseIterator<DummyIterator<X>>, typename ReverseIterator<DummyIterator<X>>::ValueType>, "`ReverseIterator` is malformed.");
     static_assert(IsForwardIterator<AccessibleReverseIterator<AccessibleDummyIterator<X>>, typename AccessibleReverseIterator<AccessibleDummyIterator<X>>::ValueType>, "`AccessibleReverseIterator` is malformed.");
+    static_assert(!IsSplittableIterator<ZipIterator<DummyIterator<X>, DummyIterator<Y>>, typename ZipIterator<DummyIterator<X>, DummyIterator<Y>>::ValueType>, "`ZipIterator` cannot jump without its parts.");
 #endif // FEATURE_ASSERTION
 
 } // namespace Rong
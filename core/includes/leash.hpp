@@ -17,6 +17,13 @@ namespace Rong
         A::deallocate(p_pointer);
     }
 
+    /// Only deinitializes; for values whose memory is reclaimed by their owner, e.g. an `Arena`.
+    template <class T>
+    auto leash_destruct(T *p_pointer) -> void
+    {
+        p_pointer->~T();
+    }
+
     template <class T, LeashDestroyFunction<T> A = leash_default_destroy<T>>
     class Leash;
 
@@ -43,12 +50,24 @@ namespace Rong
 
         inline auto operator=(Leash &&p_leash) -> Leash &
         {
+            if (this == &p_leash)
+                return *this;
+            if (value_pointer != nullptr)
+                A(value_pointer);
             value_pointer = p_leash.value_pointer;
             p_leash.value_pointer = nullptr;
             return *this;
         }
 
-        inline operator B() { return value_pointer != nullptr; }
+        /// Gives up ownership without destroying the value.
+        inline auto release() -> ValueType *
+        {
+            auto released = value_pointer;
+            value_pointer = nullptr;
+            return released;
+        }
+
+        inline operator B() const { return value_pointer != nullptr; }
         inline auto operator->() -> ValueType * { return value_pointer; }
         inline auto operator->() const -> const ValueType * { return value_pointer; }
         inline auto operator*() -> ValueType * { return value_pointer; }
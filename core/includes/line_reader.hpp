@@ -0,0 +1,248 @@
+#ifndef RG_CORE_LINE_READER_HPP
+#define RG_CORE_LINE_READER_HPP
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "def.hpp"
+#include "exception.hpp"
+#include "list.hpp"
+
+namespace Rong
+{
+    /// Splits a descriptor into delimiter-terminated records using constant memory.
+    /// A background thread reads the next chunk while the current one is being consumed, so at most two chunks are resident.
+    /// Records are views into a chunk; the rare record that straddles chunks is joined in a separate carry buffer.
+    /// Either way a record stays valid only until the next call to `next`.
+    class LineReader
+    {
+    public:
+        static constexpr const Size DEFAULT_CHUNK_SIZE = 1 << 20;
+
+    private:
+        I descriptor;
+        B owns_descriptor;
+        C delimiter;
+        Size chunk_size;
+        List<C> chunks[2];
+        Size chunk_counts[2];
+
+        pthread_t thread;
+        pthread_mutex_t lock;
+        pthread_cond_t condition;
+        Size filled_count;
+        Size consumed_count;
+        B ended;
+        B failed;
+        B stopping;
+
+        // Consumer side, touched only by the thread calling `next`.
+        Size taken_count;
+        const C *cursor;
+        const C *chunk_end;
+        List<C> carry;
+        B carry_emitted;
+        B finished;
+
+        static auto fill(void *p_reader) -> void *
+        {
+            auto reader = static_cast<LineReader *>(p_reader);
+            for (Size index = 0;; index++)
+            {
+                pthread_mutex_lock(&reader->lock);
+                while (!reader->stopping && index - reader->consumed_count >= 2)
+                    pthread_cond_wait(&reader->condition, &reader->lock);
+                const auto stopping = reader->stopping;
+                pthread_mutex_unlock(&reader->lock);
+                if (stopping)
+                    return nullptr;
+
+                // Fill the whole chunk so pipes delivering small writes still yield large chunks.
+                auto buffer = reader->chunks[index % 2].access_data();
+                Size filled = 0;
+                I64 read_count = 1;
+                while (filled < reader->chunk_size)
+                {
+                    read_count = read(reader->descriptor, buffer + filled, reader->chunk_size - filled);
+                    if (read_count < 0 && errno == EINTR)
+                        continue;
+                    if (read_count <= 0)
+                        break;
+                    filled += read_count;
+                }
+
+                pthread_mutex_lock(&reader->lock);
+                reader->chunk_counts[index % 2] = filled;
+                if (filled != 0)
+                    reader->filled_count = index + 1;
+                const auto ended = read_count <= 0;
+                reader->ended = ended;
+                reader->failed = read_count < 0;
+                pthread_cond_broadcast(&reader->condition);
+                pthread_mutex_unlock(&reader->lock);
+                if (ended)
+                    return nullptr;
+            }
+        }
+
+        /// Hands the current chunk back to the background thread and waits for the next one.
+        auto advance() -> B
+        {
+            if (finished)
+                return false;
+
+            pthread_mutex_lock(&lock);
+            consumed_count = taken_count;
+            pthread_cond_broadcast(&condition);
+            while (filled_count <= taken_count && !ended)
+                pthread_cond_wait(&condition, &lock);
+            const auto available = filled_count > taken_count;
+            const auto read_failed = failed;
+            pthread_mutex_unlock(&lock);
+
+            if (!available)
+            {
+                finished = true;
+                cursor = chunk_end = nullptr;
+                if (read_failed)
+                    throw Exception<RUNTIME>("Unable to read input.");
+                return false;
+            }
+
+            const auto index = taken_count++ % 2;
+            cursor = chunks[index].view_data();
+            chunk_end = cursor + chunk_counts[index];
+            return true;
+        }
+
+        auto append_carry(const C *p_data, Size p_count) -> void
+        {
+            const auto old_count = carry.get_count();
+            carry.resize(old_count + p_count);
+            memcpy(carry.access_data() + old_count, p_data, p_count);
+        }
+
+        auto start() -> void
+        {
+            if (chunk_size == 0)
+                throw Exception<LOGICAL>("Chunk size must be positive.");
+            chunks[0].resize(chunk_size);
+            chunks[1].resize(chunk_size);
+
+            pthread_mutex_init(&lock, nullptr);
+            pthread_cond_init(&condition, nullptr);
+            if (pthread_create(&thread, nullptr, fill, this) != 0)
+            {
+                pthread_cond_destroy(&condition);
+                pthread_mutex_destroy(&lock);
+                throw Exception<RUNTIME>("Unable to create reader thread.");
+            }
+        }
+
+    public:
+        /// Reads from a descriptor the caller keeps ownership of.
+        LineReader(I p_descriptor, Size p_chunk_size = DEFAULT_CHUNK_SIZE, C p_delimiter = '\n')
+            : descriptor(p_descriptor), owns_descriptor(false), delimiter(p_delimiter), chunk_size(p_chunk_size), chunks(), chunk_counts{0, 0},
+              filled_count(0), consumed_count(0), ended(false), failed(false), stopping(false),
+              taken_count(0), cursor(nullptr), chunk_end(nullptr), carry(), carry_emitted(false), finished(false)
+        {
+            start();
+        }
+
+        LineReader(const C *p_path, Size p_chunk_size = DEFAULT_CHUNK_SIZE, C p_delimiter = '\n')
+            : descriptor(-1), owns_descriptor(true), delimiter(p_delimiter), chunk_size(p_chunk_size), chunks(), chunk_counts{0, 0},
+              filled_count(0), consumed_count(0), ended(false), failed(false), stopping(false),
+              taken_count(0), cursor(nullptr), chunk_end(nullptr), carry(), carry_emitted(false), finished(false)
+        {
+            descriptor = open(p_path, O_RDONLY | O_CLOEXEC);
+            if (descriptor < 0)
+                throw Exception<RUNTIME>("Unable to open file for reading.");
+            posix_fadvise(descriptor, 0, 0, POSIX_FADV_SEQUENTIAL);
+            try
+            {
+                start();
+            }
+            catch (...)
+            {
+                close(descriptor);
+                throw;
+            }
+        }
+
+        LineReader(const LineReader &p_reader) = delete;
+        LineReader(LineReader &&p_reader) = delete;
+
+        /// Waits for an in-flight `read`, which on a pipe lasts until data or end of stream arrives.
+        ~LineReader()
+        {
+            pthread_mutex_lock(&lock);
+            stopping = true;
+            pthread_cond_broadcast(&condition);
+            pthread_mutex_unlock(&lock);
+            pthread_join(thread, nullptr);
+            pthread_cond_destroy(&condition);
+            pthread_mutex_destroy(&lock);
+            if (owns_descriptor)
+                close(descriptor);
+        }
+
+        /// Points `p_record` at the next record without its delimiter; false once the input is exhausted.
+        /// A final record lacking a delimiter is still returned.
+        auto next(ListView<C> &p_record) -> B
+        {
+            if (carry_emitted)
+            {
+                carry.resize(0);
+                carry_emitted = false;
+            }
+
+            while (true)
+            {
+                if (cursor != chunk_end)
+                {
+                    const auto found = static_cast<const C *>(memchr(cursor, delimiter, chunk_end - cursor));
+                    if (found != nullptr)
+                    {
+                        if (carry.get_count() == 0)
+                            p_record = ListView<C>(cursor, found - cursor);
+                        else
+                        {
+                            append_carry(cursor, found - cursor);
+                            p_record = carry;
+                            carry_emitted = true;
+                        }
+                        cursor = found + 1;
+                        return true;
+                    }
+
+                    append_carry(cursor, chunk_end - cursor);
+                    cursor = chunk_end;
+                }
+
+                if (!advance())
+                {
+                    if (carry.get_count() == 0)
+                        return false;
+                    p_record = carry;
+                    carry_emitted = true;
+                    return true;
+                }
+            }
+        }
+
+        /// Calls `p_callable(index, record)` for every remaining record.
+        template <class F>
+        auto for_each(const F &p_callable) -> void
+        {
+            auto record = ListView<C>();
+            for (Size i = 0; next(record); i++)
+                p_callable(i, record);
+        }
+    };
+
+} // namespace Rong
+
+#endif // RG_CORE_LINE_READER_HPP
\ No newline at end of file
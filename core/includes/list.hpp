@@ -28,6 +28,9 @@ namespace Rong
     template <class T>
     class ListView;
 
+    template <class T>
+    class AccessibleListView;
+
     template <IsListBaseFeaturesAvailable T>
     constexpr auto list_slice(const T &p_list, const typename T::KeyType &p_begin_index, const typename T::KeyType &p_end_index) -> ListView<typename T::ValueType>
     {
@@ -66,6 +69,21 @@ namespace Rong
         return 0;
     }
 
+    template <IsListBaseFeaturesAvailable T>
+        requires IsHashAvailable<typename T::ValueType>
+    auto hash(const T &p_list) -> U64
+    {
+        if constexpr (IsInteger<typename T::ValueType>)
+            return hash_bytes(p_list.view_data(), p_list.get_count() * sizeof(typename T::ValueType));
+        else
+        {
+            auto result = hash(p_list.get_count());
+            for (auto it = p_list.cbegin(); it != p_list.cend(); ++it)
+                result = hash_combine(result, hash(*it));
+            return result;
+        }
+    }
+
     template <IsListBaseFeaturesAvailable T>
         requires IsConstrastAvailable<typename T::ValueType, typename T::ValueType>
     constexpr auto list_contains(const T &p_list, const typename T::ValueType &p_thing) -> B
@@ -88,7 +106,7 @@ namespace Rong
     auto list_map(const T &p_list, C &&p_callable) -> List<R>
     {
         auto result = List<R>();
-        result.reserve(p_list.get_capacity());
+        result.reserve(p_list.get_count());
 
         for_each([&](Size p_index, auto p_element)
                  { result.append(p_callable(p_index, p_element)); }, p_list.cbegin(), p_list.cend());
@@ -104,7 +122,7 @@ namespace Rong
         result.reserve(p_list.get_count());
 
         for_each([&](Size p_index, auto p_element)
-                 { if constexpr (p_callable(p_index, p_element)) result.append(p_element); }, p_list.cbegin(), p_list.cend());
+                 { if (p_callable(p_index, p_element)) result.append(p_element); }, p_list.cbegin(), p_list.cend());
 
         return result;
     }
@@ -126,7 +144,8 @@ namespace Rong
 
     template <class T>
         requires IsSame<T, List<typename T::ValueType>> ||
-                 IsSame<T, ListView<typename T::ValueType>>
+                 IsSame<T, ListView<typename T::ValueType>> ||
+                 IsSame<T, AccessibleListView<typename T::ValueType>>
     class ListIterator
     {
     public:
@@ -153,6 +172,12 @@ namespace Rong
             return *this;
         }
         constexpr auto operator+(KeyType p_increment) const -> ListIterator { return ListIterator(container, current_key + p_increment); }
+        constexpr auto operator+=(I64 p_offset) -> ListIterator
+        {
+            current_key += p_offset;
+            return *this;
+        }
+        constexpr auto operator-(const ListIterator &p_right) const -> I64 { return static_cast<I64>(current_key - p_right.current_key); }
     };
 
     template <class T>
@@ -200,6 +225,47 @@ namespace Rong
         }
     };
 
+    /// `ListView` over elements the holder may also write to.
+    template <class T>
+    class AccessibleListView
+    {
+    public:
+        using KeyType = Size;
+        using ValueType = T;
+        using ElementType = ValueType;
+
+    private:
+        ElementType *data;
+        Size count;
+
+    public:
+        constexpr AccessibleListView(ValueType *p_data, Size p_count) : data(p_data), count(p_count) {}
+        constexpr AccessibleListView() : data(nullptr), count(0) {}
+
+        constexpr auto view_data() const -> const ValueType * { return data; }
+        constexpr auto access_data() -> ValueType * { return data; }
+        constexpr auto get_count() const -> Size { return count; }
+
+        constexpr operator ListView<ValueType>() const { return ListView<ValueType>(data, count); }
+
+        constexpr auto cbegin() const -> ListIterator<AccessibleListView> { return ListIterator<AccessibleListView>(*this); }
+        constexpr auto cend() const -> ListIterator<AccessibleListView> { return ListIterator<AccessibleListView>(*this, count); }
+
+        constexpr auto operator[](const KeyType &p_index) -> ValueType &
+        {
+            if (p_index >= count)
+                throw Exception<LOGICAL>("Given index is beyond list's element count.");
+            return data[p_index];
+        }
+
+        constexpr auto operator[](const KeyType &p_index) const -> const ValueType &
+        {
+            if (p_index >= count)
+                throw Exception<LOGICAL>("Given index is beyond list's element count.");
+            return data[p_index];
+        }
+    };
+
     template <class T, template <class E> class A>
         requires IsAllocatorFeaturesAvailable<A<X>, X>
     class List
@@ -243,12 +309,19 @@ namespace Rong
                 return *this;
             }
             inline auto operator+(KeyType p_increment) const -> AccessibleIterator { return AccessibleIterator(container, current_key + p_increment); }
+            inline auto operator+=(I64 p_offset) -> AccessibleIterator
+            {
+                current_key += p_offset;
+                return *this;
+            }
+            inline auto operator-(const AccessibleIterator &p_right) const -> I64 { return static_cast<I64>(current_key - p_right.current_key); }
         };
 
     public:
         constexpr List() : data(nullptr), count(0), capacity(0) {}
 
         inline auto view_data() const -> const ValueType * { return data; }
+        inline auto access_data() -> ValueType * { return data; }
         inline auto get_count() const -> Size { return count; }
         inline auto get_capacity() const -> Size { return capacity; }
 
@@ -288,6 +361,15 @@ namespace Rong
             count = p_count;
         }
 
+        /// Drains any forward iterator range, such as a `Generator`, whose length is not known up front.
+        template <class I>
+            requires IsForwardIterator<I, const ValueType &>
+        List(I p_begin, I p_end) : List()
+        {
+            for (; !(p_begin == p_end); ++p_begin)
+                append(*p_begin);
+        }
+
         List(const List &p_list) : List(p_list.count)
         {
             for (auto it = p_list.cbegin(); it != p_list.cend(); ++it)
@@ -306,6 +388,31 @@ namespace Rong
             clean();
         }
 
+        auto operator=(const List &p_list) -> List &
+        {
+            if (this == &p_list)
+                return *this;
+            clean();
+            reserve(p_list.count);
+            for (auto it = p_list.cbegin(); it != p_list.cend(); ++it)
+                append(*it);
+            return *this;
+        }
+
+        auto operator=(List &&p_list) -> List &
+        {
+            if (this == &p_list)
+                return *this;
+            clean();
+            data = p_list.data;
+            count = p_list.count;
+            capacity = p_list.capacity;
+            p_list.data = nullptr;
+            p_list.count = 0;
+            p_list.capacity = 0;
+            return *this;
+        }
+
         inline auto operator[](const KeyType &p_index) -> ValueType &
         {
             if (p_index >= count)
@@ -322,7 +429,7 @@ namespace Rong
 
         auto reserve(Size p_min_capacity) -> void
         {
-            if (p_min_capacity < capacity)
+            if (p_min_capacity <= capacity)
                 return;
 
             auto list = List(p_min_capacity);
@@ -341,11 +448,22 @@ namespace Rong
             list.capacity = 0;
         }
 
+        /// Drops trailing elements or appends default-valued ones, so the storage can be filled in place.
+        auto resize(Size p_count) -> void
+        {
+            reserve(p_count);
+            for (auto i = p_count; i < count; i++)
+                data[i].~ValueType();
+            for (auto i = count; i < p_count; i++)
+                data[i] = ValueType();
+            count = p_count;
+        }
+
         auto clean() -> void
         {
             if (data != nullptr && capacity != 0)
             {
-                for (auto element : *this)
+                for (auto &element : *this)
                     element.~ValueType();
                 Allocator::deallocate(data);
             }
@@ -358,7 +476,7 @@ namespace Rong
         {
             if (p_index > count)
                 throw Exception<LOGICAL>("Given index is out of bound.");
-            reserve(capacity + 1);
+            reserve(count + 1);
             count++;
 
             auto target_iterable = accessible_reverse(begin() + p_index + 1, end());
@@ -371,7 +489,8 @@ namespace Rong
 
         auto append(const ValueType &p_thing) -> void
         {
-            insert(count, p_thing);
+            const auto index = count; // `insert` takes the index by reference and grows `count`.
+            insert(index, p_thing);
         }
 
         auto prepend(const ValueType &p_thing) -> void
@@ -413,6 +532,8 @@ namespace Rong
 #ifdef FEATURE_ASSERTION
     static_assert(IsBidirectionalIterator<ListIterator<List<X>>>, "`ListIterator` is malformed.");
     static_assert(IsBidirectionalIterator<List<X>::AccessibleIterator, List<X>::AccessibleIterator::ValueType &>, "`List::AccessibleIterator` is malformed.");
+    static_assert(IsSplittableIterator<ListIterator<List<X>>>, "`ListIterator` is not splittable.");
+    static_assert(IsSplittableIterator<List<X>::AccessibleIterator, List<X>::AccessibleIterator::ValueType &>, "`List::AccessibleIterator` is not splittable.");
 
     static_assert(IsListBaseFeaturesAvailable<ListView<X>>, "`ListView` features are malformed.");
     static_assert(IsEqualAvailable<ListView<X>, List<X>>, "`ListView::operator==` is malformed.");
@@ -449,6 +570,9 @@ namespace Rong
     static_assert(IsPopFrontAvailable<List<X>>, "`List::pop_front` is malformed.");
     static_assert(IsIteratorAvailable<List<X>>, "`List` iterator is malformed.");
     static_assert(IsIteratorAccessible<List<X>>, "`List` accessible iterator is malformed.");
+    static_assert(IsDataAccessible<List<X>>, "`List::access_data` is malformed.");
+    static_assert(IsDataAvailable<AccessibleListView<X>>, "`AccessibleListView::view_data` is malformed.");
+    static_assert(IsDataAccessible<AccessibleListView<X>>, "`AccessibleListView::access_data` is malformed.");
 #endif // FEATURE_ASSERTION
 
 } // namespace Rong
@@ -0,0 +1,81 @@
+#ifndef RG_CORE_LOCK_HPP
+#define RG_CORE_LOCK_HPP
+
+#include <pthread.h>
+
+#include "def.hpp"
+#include "exception.hpp"
+
+namespace Rong
+{
+
+    class Mutex
+    {
+    private:
+        pthread_mutex_t handle;
+
+    public:
+        Mutex()
+        {
+            if (pthread_mutex_init(&handle, nullptr) != 0)
+                throw Exception<RUNTIME>("Unable to initialize mutex.");
+        }
+
+        Mutex(const Mutex &p_mutex) = delete;
+        Mutex(Mutex &&p_mutex) = delete;
+
+        ~Mutex()
+        {
+            pthread_mutex_destroy(&handle);
+        }
+
+        inline auto lock() -> void { pthread_mutex_lock(&handle); }
+        inline auto unlock() -> void { pthread_mutex_unlock(&handle); }
+    };
+
+    /// Lock shared by any number of readers or held by a single writer.
+    class ReadWriteLock
+    {
+    private:
+        pthread_rwlock_t handle;
+
+    public:
+        ReadWriteLock()
+        {
+            if (pthread_rwlock_init(&handle, nullptr) != 0)
+                throw Exception<RUNTIME>("Unable to initialize read-write lock.");
+        }
+
+        ReadWriteLock(const ReadWriteLock &p_lock) = delete;
+        ReadWriteLock(ReadWriteLock &&p_lock) = delete;
+
+        ~ReadWriteLock()
+        {
+            pthread_rwlock_destroy(&handle);
+        }
+
+        inline auto lock_read() -> void { pthread_rwlock_rdlock(&handle); }
+        inline auto lock_write() -> void { pthread_rwlock_wrlock(&handle); }
+        inline auto unlock() -> void { pthread_rwlock_unlock(&handle); }
+    };
+
+    /// Holds `p_lock` until the end of the scope.
+    template <class T, auto Acquire>
+    class LockGuard
+    {
+    private:
+        T &lock;
+
+    public:
+        inline LockGuard(T &p_lock) : lock(p_lock) { (lock.*Acquire)(); }
+        LockGuard(const LockGuard &p_guard) = delete;
+        inline ~LockGuard() { lock.unlock(); }
+    };
+
+    using MutexGuard = LockGuard<Mutex, &Mutex::lock>;
+    using ReadGuard = LockGuard<ReadWriteLock, &ReadWriteLock::lock_read>;
+    using WriteGuard = LockGuard<ReadWriteLock, &ReadWriteLock::lock_write>;
+
+} // namespace Rong
+
+#endif // RG_CORE_LOCK_HPP
\ No newline at end of file
@@ -0,0 +1,176 @@
+#ifndef RG_CORE_MAPPED_LIST_HPP
+#define RG_CORE_MAPPED_LIST_HPP
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "def.hpp"
+#include "exception.hpp"
+#include "list.hpp"
+
+namespace Rong
+{
+    enum MappingKind
+    {
+        READ_ONLY,
+        /// Writable, but writes stay private to the mapping and never reach the file.
+        COPY_ON_WRITE
+    };
+
+    enum MappingAdvice
+    {
+        ADVICE_NORMAL,
+        ADVICE_SEQUENTIAL,
+        ADVICE_RANDOM,
+        ADVICE_WILL_NEED
+    };
+
+    /// Array of `T` read straight out of a memory-mapped file; pages are loaded on first touch instead of copied up front.
+    template <class T>
+        requires IsTriviallyCopyable<T>
+    class MappedList
+    {
+    public:
+        using KeyType = Size;
+        using ValueType = T;
+        using ElementType = ValueType;
+
+    private:
+        U8 *mapping;
+        Size mapping_size;
+        ElementType *data;
+        Size count;
+        MappingKind kind;
+
+    public:
+        MappedList() : mapping(nullptr), mapping_size(0), data(nullptr), count(0), kind(READ_ONLY) {}
+
+        /// Maps the file at `p_path`, skipping `p_offset` header bytes before the first element.
+        MappedList(const C *p_path, MappingKind p_kind = READ_ONLY, Size p_offset = 0) : MappedList()
+        {
+            kind = p_kind;
+            const auto descriptor = open(p_path, O_RDONLY | O_CLOEXEC);
+            if (descriptor < 0)
+                throw Exception<RUNTIME>("Unable to open file for mapping.");
+
+            struct stat status;
+            if (fstat(descriptor, &status) != 0)
+            {
+                close(descriptor);
+                throw Exception<RUNTIME>("Unable to query mapped file size.");
+            }
+
+            mapping_size = status.st_size;
+            if (p_offset > mapping_size)
+            {
+                close(descriptor);
+                throw Exception<LOGICAL>("Given offset is beyond the file's size.");
+            }
+            if ((mapping_size - p_offset) % sizeof(ElementType) != 0)
+            {
+                close(descriptor);
+                throw Exception<LOGICAL>("File size is not a whole number of elements.");
+            }
+            if (p_offset % alignof(ElementType) != 0)
+            {
+                close(descriptor);
+                throw Exception<LOGICAL>("Given offset is misaligned for the element type.");
+            }
+
+            if (mapping_size != 0)
+            {
+                const auto protection = kind == READ_ONLY ? PROT_READ : PROT_READ | PROT_WRITE;
+                auto address = mmap(nullptr, mapping_size, protection, MAP_PRIVATE, descriptor, 0);
+                if (address == MAP_FAILED)
+                {
+                    close(descriptor);
+                    throw Exception<RUNTIME>("Unable to map file.");
+                }
+                mapping = static_cast<U8 *>(address);
+                data = reinterpret_cast<ElementType *>(mapping + p_offset);
+                count = (mapping_size - p_offset) / sizeof(ElementType);
+            }
+            close(descriptor);
+        }
+
+        MappedList(const MappedList &p_list) = delete;
+        MappedList(MappedList &&p_list) : mapping(p_list.mapping), mapping_size(p_list.mapping_size), data(p_list.data), count(p_list.count), kind(p_list.kind)
+        {
+            p_list.mapping = nullptr;
+            p_list.mapping_size = 0;
+            p_list.data = nullptr;
+            p_list.count = 0;
+        }
+
+        ~MappedList()
+        {
+            if (mapping != nullptr)
+                munmap(mapping, mapping_size);
+            mapping = nullptr;
+            data = nullptr;
+            count = 0;
+        }
+
+        inline auto view_data() const -> const ValueType * { return data; }
+        inline auto get_count() const -> Size { return count; }
+        inline auto get_kind() const -> MappingKind { return kind; }
+
+        inline auto view() const -> ListView<ValueType> { return ListView<ValueType>(data, count); }
+        inline operator ListView<ValueType>() const { return view(); }
+
+        /// Only copy-on-write mappings are writable.
+        inline auto access() -> AccessibleListView<ValueType>
+        {
+            if (kind != COPY_ON_WRITE)
+                throw Exception<LOGICAL>("Read-only mapping cannot be written.");
+            return AccessibleListView<ValueType>(data, count);
+        }
+
+        /// Tells the kernel how the mapping will be read, to tune read-ahead.
+        auto advise(MappingAdvice p_advice) const -> void
+        {
+            if (mapping == nullptr)
+                return;
+
+            I advice = MADV_NORMAL;
+            switch (p_advice)
+            {
+            case ADVICE_SEQUENTIAL:
+                advice = MADV_SEQUENTIAL;
+                break;
+            case ADVICE_RANDOM:
+                advice = MADV_RANDOM;
+                break;
+            case ADVICE_WILL_NEED:
+                advice = MADV_WILLNEED;
+                break;
+            default:
+                break;
+            }
+            if (madvise(mapping, mapping_size, advice) != 0)
+                throw Exception<RUNTIME>("Unable to advise mapping.");
+        }
+
+        inline auto slice(const KeyType &p_begin_index, const KeyType &p_end_index) const -> ListView<ValueType> { return view().slice(p_begin_index, p_end_index); }
+        inline auto contains(const ValueType &p_thing) const -> B { return view().contains(p_thing); }
+
+        template <class C>
+        inline auto for_each(const C &p_callable) const -> void { view().for_each(p_callable); }
+        template <class R, class C>
+        inline auto map(const C &p_callable) const -> List<R> { return view().template map<R>(p_callable); }
+        template <class C>
+        inline auto filter(const C &p_callable) const -> List<ValueType> { return view().filter(p_callable); }
+
+        inline auto operator[](const KeyType &p_index) const -> const ValueType &
+        {
+            if (p_index >= count)
+                throw Exception<LOGICAL>("Given index is beyond list's element count.");
+            return data[p_index];
+        }
+    };
+
+} // namespace Rong
+
+#endif // RG_CORE_MAPPED_LIST_HPP
\ No newline at end of file
@@ -18,9 +18,31 @@ namespace Rong
         FirstValueType first;
         SecondValueType second;
 
-        constexpr Pair(T p_first, W p_second) : first(p_first), second(p_second) {}
+        constexpr Pair() = default;
+        template <class U, class V>
+        constexpr Pair(U &&p_first, V &&p_second) : first(static_cast<U &&>(p_first)), second(static_cast<V &&>(p_second)) {}
     };
 
+    template <class T, class W>
+    Pair(T, W) -> Pair<T, W>;
+
+    template <class T, class W>
+        requires IsConstrastAvailable<T> && IsConstrastAvailable<W>
+    constexpr auto contrast(const Pair<T, W> &p_left, const Pair<T, W> &p_right) -> I
+    {
+        const auto first_contrast = contrast(p_left.first, p_right.first);
+        if (first_contrast != 0)
+            return first_contrast;
+        return contrast(p_left.second, p_right.second);
+    }
+
+    template <class T, class W>
+        requires IsHashAvailable<T> && IsHashAvailable<W>
+    inline auto hash(const Pair<T, W> &p_pair) -> U64
+    {
+        return hash_combine(hash(p_pair.first), hash(p_pair.second));
+    }
+
 } // namespace Rong
 
 #endif // RG_CORE_PAIR_HPP
\ No newline at end of file
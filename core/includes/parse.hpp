@@ -0,0 +1,249 @@
+#ifndef RG_CORE_PARSE_HPP
+#define RG_CORE_PARSE_HPP
+
+#include <locale.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "def.hpp"
+#include "exception.hpp"
+#include "list.hpp"
+
+namespace Rong
+{
+    /// Outcome of a bulk parse. Parsing stops at the first malformed field, so the appended values are exactly the leading fields.
+    class ParseResult
+    {
+    public:
+        static constexpr const Size NO_ERROR = ~static_cast<Size>(0);
+
+        Size count;
+        /// Index of the offending byte in the input, or `NO_ERROR`.
+        Size error_index;
+
+        inline auto is_success() const -> B { return error_index == NO_ERROR; }
+    };
+
+    constexpr const Size PARSE_EXACT_DIGIT_COUNT = 19;
+
+    constexpr const F64 PARSE_EXACT_POWERS[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+                                                1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+    inline auto is_digit(C p_character) -> B { return static_cast<U8>(p_character - '0') < 10; }
+
+    /// True when all eight little-endian bytes of `p_block` are ASCII digits.
+    inline auto is_eight_digits(U64 p_block) -> B
+    {
+        return ((p_block & 0xF0F0F0F0F0F0F0F0) | (((p_block + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) >> 4)) == 0x3333333333333333;
+    }
+
+    /// Value of eight ASCII digits, first digit in the lowest byte, using three multiplications instead of eight.
+    inline auto parse_eight_digits(U64 p_block) -> U32
+    {
+        p_block -= 0x3030303030303030;
+        p_block = (p_block * 10) + (p_block >> 8);
+        p_block = (((p_block & 0x000000FF000000FF) * (100 + (1000000ULL << 32))) +
+                   (((p_block >> 16) & 0x000000FF000000FF) * (1 + (10000ULL << 32)))) >>
+                  32;
+        return static_cast<U32>(p_block);
+    }
+
+    /// Consumes the digits from `p_index`, folding the first `PARSE_EXACT_DIGIT_COUNT` into `p_value`; `p_digit_count` counts all of them.
+    inline auto parse_digit_run(const C *p_data, Size p_index, Size p_end, U64 &p_value, Size &p_digit_count) -> Size
+    {
+        while (p_index + 8 <= p_end && p_digit_count + 8 <= PARSE_EXACT_DIGIT_COUNT)
+        {
+            U64 block;
+            memcpy(&block, p_data + p_index, sizeof(block));
+            if (!is_eight_digits(block))
+                break;
+            p_value = p_value * 100000000 + parse_eight_digits(block);
+            p_digit_count += 8;
+            p_index += 8;
+        }
+
+        for (; p_index < p_end && is_digit(p_data[p_index]); p_index++, p_digit_count++)
+            if (p_digit_count < PARSE_EXACT_DIGIT_COUNT)
+                p_value = p_value * 10 + (p_data[p_index] - '0');
+        return p_index;
+    }
+
+    inline auto skip_zeros(const C *p_data, Size p_index, Size p_end) -> Size
+    {
+        while (p_index < p_end && p_data[p_index] == '0')
+            p_index++;
+        return p_index;
+    }
+
+    /// Appends every `p_delimiter`-separated decimal integer in `p_text` to `p_values`. A trailing delimiter is allowed.
+    template <class T>
+        requires IsInteger<T>
+    auto parse_integers(const ListView<C> &p_text, C p_delimiter, List<T> &p_values) -> ParseResult
+    {
+        constexpr B IS_SIGNED = static_cast<T>(-1) < static_cast<T>(0);
+        constexpr U64 MAX_MAGNITUDE = IS_SIGNED ? (static_cast<U64>(1) << (sizeof(T) * 8 - 1)) - 1 : static_cast<U64>(static_cast<T>(~static_cast<T>(0)));
+
+        const auto data = p_text.view_data();
+        const auto end = p_text.get_count();
+        auto result = ParseResult{0, ParseResult::NO_ERROR};
+        Size i = 0;
+        while (i < end)
+        {
+            const auto negative = IS_SIGNED && data[i] == '-';
+            if (data[i] == '-' || data[i] == '+')
+            {
+                if (data[i] == '-' && !IS_SIGNED)
+                {
+                    result.error_index = i;
+                    return result;
+                }
+                i++;
+            }
+
+            const auto field_begin = i;
+            i = skip_zeros(data, i, end);
+            const auto significant_begin = i;
+            U64 magnitude = 0;
+            Size digit_count = 0;
+            i = parse_digit_run(data, i, end, magnitude, digit_count);
+            if (i == field_begin || (i < end && data[i] != p_delimiter))
+            {
+                result.error_index = i;
+                return result;
+            }
+
+            // The digit run folded only the first 19 digits; a twentieth still fits in U64 unless it overflows.
+            if (digit_count > PARSE_EXACT_DIGIT_COUNT + 1 ||
+                (digit_count == PARSE_EXACT_DIGIT_COUNT + 1 &&
+                 (__builtin_mul_overflow(magnitude, 10, &magnitude) || __builtin_add_overflow(magnitude, data[i - 1] - '0', &magnitude))) ||
+                magnitude > MAX_MAGNITUDE + negative)
+            {
+                result.error_index = significant_begin;
+                return result;
+            }
+
+            p_values.append(negative ? static_cast<T>(0 - magnitude) : static_cast<T>(magnitude));
+            result.count++;
+            i++;
+        }
+        return result;
+    }
+
+    /// Exactly rounded conversion of a decimal field that `parse_floats` could not take through the fast path.
+    /// Converts in the "C" locale, so the decimal point stays '.' whatever `LC_NUMERIC` the process has set.
+    inline auto parse_float_slow(const C *p_field, Size p_count) -> F64
+    {
+        static const auto numeric_locale = newlocale(LC_NUMERIC_MASK, "C", static_cast<locale_t>(0));
+        if (numeric_locale == static_cast<locale_t>(0))
+            throw Exception<RUNTIME>("Unable to create the C numeric locale.");
+
+        C buffer[64];
+        auto spill = List<C>();
+        auto text = buffer;
+        if (p_count >= sizeof(buffer))
+        {
+            spill.resize(p_count + 1);
+            text = spill.access_data();
+        }
+        memcpy(text, p_field, p_count);
+        text[p_count] = '\0';
+        return strtod_l(text, nullptr, numeric_locale);
+    }
+
+    /// Appends every `p_delimiter`-separated decimal number, optionally with fraction and exponent, in `p_text` to `p_values`.
+    /// Up to 15 significant digits with a small exponent are converted exactly with one multiplication or division;
+    /// anything else falls back to `strtod`, so every result is correctly rounded.
+    inline auto parse_floats(const ListView<C> &p_text, C p_delimiter, List<F64> &p_values) -> ParseResult
+    {
+        const auto data = p_text.view_data();
+        const auto end = p_text.get_count();
+        auto result = ParseResult{0, ParseResult::NO_ERROR};
+        Size i = 0;
+        while (i < end)
+        {
+            const auto field_begin = i;
+            const auto negative = data[i] == '-';
+            if (data[i] == '-' || data[i] == '+')
+                i++;
+
+            const auto digits_begin = i;
+            U64 mantissa = 0;
+            Size digit_count = 0;
+            I64 exponent = 0;
+            i = skip_zeros(data, i, end);
+            i = parse_digit_run(data, i, end, mantissa, digit_count);
+            auto has_digits = i != digits_begin;
+            if (digit_count > PARSE_EXACT_DIGIT_COUNT)
+                exponent += digit_count - PARSE_EXACT_DIGIT_COUNT;
+
+            if (i < end && data[i] == '.')
+            {
+                i++;
+                const auto fraction_begin = i;
+                if (digit_count == 0)
+                {
+                    i = skip_zeros(data, i, end);
+                    exponent -= i - fraction_begin;
+                }
+                const auto previous_count = digit_count;
+                i = parse_digit_run(data, i, end, mantissa, digit_count);
+                const auto folded = (digit_count < PARSE_EXACT_DIGIT_COUNT ? digit_count : PARSE_EXACT_DIGIT_COUNT) -
+                                    (previous_count < PARSE_EXACT_DIGIT_COUNT ? previous_count : PARSE_EXACT_DIGIT_COUNT);
+                exponent -= folded;
+                has_digits = has_digits || i != fraction_begin;
+            }
+            if (!has_digits)
+            {
+                result.error_index = i;
+                return result;
+            }
+
+            if (i < end && (data[i] == 'e' || data[i] == 'E'))
+            {
+                i++;
+                const auto exponent_negative = i < end && data[i] == '-';
+                if (i < end && (data[i] == '-' || data[i] == '+'))
+                    i++;
+                const auto exponent_begin = i;
+                U64 written_exponent = 0;
+                Size exponent_digit_count = 0;
+                i = parse_digit_run(data, i, end, written_exponent, exponent_digit_count);
+                if (i == exponent_begin)
+                {
+                    result.error_index = i;
+                    return result;
+                }
+                // Exponents this large saturate to zero or infinity either way.
+                if (exponent_digit_count > 6)
+                    written_exponent = 999999;
+                exponent += exponent_negative ? -static_cast<I64>(written_exponent) : static_cast<I64>(written_exponent);
+            }
+
+            if (i < end && data[i] != p_delimiter)
+            {
+                result.error_index = i;
+                return result;
+            }
+
+            F64 value;
+            if (digit_count <= 15 && exponent >= -22 && exponent <= 22)
+            {
+                // Both operands are exact doubles, so IEEE rounding of their product or quotient is the correct result.
+                value = static_cast<F64>(mantissa);
+                value = exponent < 0 ? value / PARSE_EXACT_POWERS[-exponent] : value * PARSE_EXACT_POWERS[exponent];
+                if (negative)
+                    value = -value;
+            }
+            else
+                value = parse_float_slow(data + field_begin, i - field_begin);
+
+            p_values.append(value);
+            result.count++;
+            i++;
+        }
+        return result;
+    }
+
+} // namespace Rong
+
+#endif // RG_CORE_PARSE_HPP
\ No newline at end of file
@@ -0,0 +1,241 @@
+#ifndef RG_CORE_PERSISTENT_BINARY_TREE_HPP
+#define RG_CORE_PERSISTENT_BINARY_TREE_HPP
+
+#include "def.hpp"
+#include "exception.hpp"
+#include "allocator.hpp"
+#include "lock.hpp"
+
+namespace Rong
+{
+    /// Immutable node shared between every version of a `PersistentBinaryTree` that reaches it.
+    template <class K, class V>
+    class PersistentBinaryTreeNode
+    {
+    public:
+        using KeyType = K;
+        using ValueType = V;
+
+    public:
+        KeyType key;
+        ValueType value;
+        PersistentBinaryTreeNode *left;
+        PersistentBinaryTreeNode *right;
+        Size count;
+        Size height;
+        Size references;
+    };
+
+    /// Balanced search tree whose `set` copies only the root-to-leaf path, so copies are O(1) snapshots.
+    /// A single thread writes and reads the tree; any other thread may take snapshots of it concurrently and read those.
+    template <IsConstrastAvailable K, class V, template <class E> class A = Allocator>
+        requires IsAllocatorFeaturesAvailable<A<X>, X>
+    class PersistentBinaryTree
+    {
+    public:
+        using KeyType = K;
+        using ValueType = V;
+        using ElementType = PersistentBinaryTreeNode<KeyType, ValueType>;
+        using Allocator = A<ElementType>;
+
+    private:
+        ElementType *root;
+        /// Held only while `root` is swapped or loaded and acquired, so a snapshot never acquires a root `set` has already released.
+        mutable Mutex root_lock;
+
+        static inline auto get_count(const ElementType *p_node) -> Size { return p_node == nullptr ? 0 : p_node->count; }
+        static inline auto get_height(const ElementType *p_node) -> Size { return p_node == nullptr ? 0 : p_node->height; }
+
+        static inline auto acquire(ElementType *p_node) -> ElementType *
+        {
+            if (p_node != nullptr)
+                __atomic_add_fetch(&p_node->references, 1, __ATOMIC_RELAXED);
+            return p_node;
+        }
+
+        static auto release(ElementType *p_node) -> void
+        {
+            if (p_node == nullptr || __atomic_sub_fetch(&p_node->references, 1, __ATOMIC_ACQ_REL) != 0)
+                return;
+
+            release(p_node->left);
+            release(p_node->right);
+            p_node->~ElementType();
+            Allocator::deallocate(p_node);
+        }
+
+        static inline auto refresh(ElementType *p_node) -> void
+        {
+            const auto left_height = get_height(p_node->left);
+            const auto right_height = get_height(p_node->right);
+            p_node->count = 1 + get_count(p_node->left) + get_count(p_node->right);
+            p_node->height = 1 + (left_height > right_height ? left_height : right_height);
+        }
+
+        /// Takes ownership of one reference to each child.
+        static auto create(const KeyType &p_key, const ValueType &p_value, ElementType *p_left, ElementType *p_right) -> ElementType *
+        {
+            auto node = Allocator::allocate();
+            node->key = p_key;
+            node->value = p_value;
+            node->left = p_left;
+            node->right = p_right;
+            node->references = 1;
+            refresh(node);
+            return node;
+        }
+
+        static inline auto rotate_left(ElementType *p_node) -> ElementType *
+        {
+            auto pivot = p_node->right;
+            p_node->right = pivot->left;
+            pivot->left = p_node;
+            refresh(p_node);
+            refresh(pivot);
+            return pivot;
+        }
+
+        static inline auto rotate_right(ElementType *p_node) -> ElementType *
+        {
+            auto pivot = p_node->left;
+            p_node->left = pivot->right;
+            pivot->right = p_node;
+            refresh(p_node);
+            refresh(pivot);
+            return pivot;
+        }
+
+        /// Restores the AVL invariant at a freshly copied node. Only nodes on the copied path can
+        /// become unbalanced, so every node rotated here is still private to the writer.
+        static auto rebalance(ElementType *p_node) -> ElementType *
+        {
+            const auto left_height = get_height(p_node->left);
+            const auto right_height = get_height(p_node->right);
+
+            if (left_height > right_height + 1)
+            {
+                if (get_height(p_node->left->left) < get_height(p_node->left->right))
+                    p_node->left = rotate_left(p_node->left);
+                return rotate_right(p_node);
+            }
+            else if (right_height > left_height + 1)
+            {
+                if (get_height(p_node->right->right) < get_height(p_node->right->left))
+                    p_node->right = rotate_right(p_node->right);
+                return rotate_left(p_node);
+            }
+            return p_node;
+        }
+
+        static auto insert(ElementType *p_node, const KeyType &p_key, const ValueType &p_value) -> ElementType *
+        {
+            if (p_node == nullptr)
+                return create(p_key, p_value, nullptr, nullptr);
+
+            const auto key_contrast = contrast(p_key, p_node->key);
+            if (key_contrast == 0)
+                return create(p_key, p_value, acquire(p_node->left), acquire(p_node->right));
+            else if (key_contrast < 0)
+                return rebalance(create(p_node->key, p_node->value, insert(p_node->left, p_key, p_value), acquire(p_node->right)));
+            else
+                return rebalance(create(p_node->key, p_node->value, acquire(p_node->left), insert(p_node->right, p_key, p_value)));
+        }
+
+        inline auto acquire_root() const -> ElementType *
+        {
+            auto guard = MutexGuard(root_lock);
+            return acquire(root);
+        }
+
+        /// Swaps in `p_root`, whose reference the tree takes over; the old root is released outside the lock.
+        auto publish(ElementType *p_root) -> void
+        {
+            ElementType *old_root;
+            {
+                auto guard = MutexGuard(root_lock);
+                old_root = root;
+                root = p_root;
+            }
+            release(old_root);
+        }
+
+        template <class C>
+        static auto for_each(const ElementType *p_node, const C &p_callable) -> void
+        {
+            if (p_node == nullptr)
+                return;
+            for_each(p_node->left, p_callable);
+            p_callable(p_node->key, p_node->value);
+            for_each(p_node->right, p_callable);
+        }
+
+    public:
+        PersistentBinaryTree() : root(nullptr) {}
+        PersistentBinaryTree(const PersistentBinaryTree &p_tree) : root(p_tree.acquire_root()) {}
+        PersistentBinaryTree(PersistentBinaryTree &&p_tree) : root(p_tree.root) { p_tree.root = nullptr; }
+
+        ~PersistentBinaryTree()
+        {
+            release(root);
+            root = nullptr;
+        }
+
+        auto operator=(const PersistentBinaryTree &p_tree) -> PersistentBinaryTree &
+        {
+            if (this != &p_tree)
+                publish(p_tree.acquire_root());
+            return *this;
+        }
+
+        auto operator=(PersistentBinaryTree &&p_tree) -> PersistentBinaryTree &
+        {
+            if (this != &p_tree)
+            {
+                release(root);
+                root = p_tree.root;
+                p_tree.root = nullptr;
+            }
+            return *this;
+        }
+
+        /// Point-in-time view that later `set` calls on this tree do not affect.
+        inline auto snapshot() const -> PersistentBinaryTree { return *this; }
+
+        inline auto get_count() const -> Size { return get_count(root); }
+        inline auto get_height() const -> Size { return get_height(root); }
+
+        auto find(const KeyType &p_key) const -> const ValueType *
+        {
+            const ElementType *node = root;
+            while (node != nullptr)
+            {
+                const auto key_contrast = contrast(p_key, node->key);
+                if (key_contrast == 0)
+                    return &node->value;
+                node = key_contrast < 0 ? node->left : node->right;
+            }
+            return nullptr;
+        }
+
+        inline auto contains(const KeyType &p_key) const -> B { return find(p_key) != nullptr; }
+
+        inline auto operator[](const KeyType &p_key) const -> const ValueType &
+        {
+            const auto found = find(p_key);
+            if (found == nullptr)
+                throw Exception<LOGICAL>("Given key is not in the tree.");
+            return *found;
+        }
+
+        auto set(const KeyType &p_key, const ValueType &p_value) -> void
+        {
+            publish(insert(root, p_key, p_value));
+        }
+
+        template <class C>
+        inline auto for_each(const C &p_callable) const -> void { for_each(root, p_callable); }
+    };
+
+} // namespace Rong
+
+#endif // RG_CORE_PERSISTENT_BINARY_TREE_HPP
\ No newline at end of file
@@ -0,0 +1,266 @@
+#ifndef RG_CORE_REACTOR_HPP
+#define RG_CORE_REACTOR_HPP
+
+#include <coroutine>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include "def.hpp"
+#include "exception.hpp"
+#include "list.hpp"
+#include "lock.hpp"
+#include "scheduler.hpp"
+#include "task.hpp"
+
+namespace Rong
+{
+    /// Coroutine suspended on the reactor, either on descriptor readiness or on offloaded work.
+    class ReactorWaiter
+    {
+    public:
+        I descriptor;
+        std::coroutine_handle<> handle;
+    };
+
+    /// Single-threaded epoll event loop that resumes `Task` coroutines when pipes or sockets become ready.
+    /// Regular files cannot be polled, so their reads run on a `Scheduler` and complete through an eventfd.
+    /// A task must not be destroyed while it is suspended on the reactor.
+    /// Pollable descriptors must already be non-blocking, e.g. from `pipe2(..., O_NONBLOCK)`; the flag is shared with every
+    /// duplicate of the descriptor, so the reactor refuses blocking ones rather than changing it behind the caller's back.
+    class Reactor
+    {
+    public:
+        static constexpr const Size EVENT_CAPACITY = 64;
+
+        class ReadinessAwaiter : public ReactorWaiter
+        {
+        private:
+            Reactor &reactor;
+            U32 events;
+
+        public:
+            inline ReadinessAwaiter(Reactor &p_reactor, I p_descriptor, U32 p_events) : ReactorWaiter{p_descriptor, nullptr}, reactor(p_reactor), events(p_events) {}
+            inline auto await_ready() const -> B { return false; }
+            inline auto await_suspend(std::coroutine_handle<> p_handle) -> void
+            {
+                handle = p_handle;
+                reactor.watch(this, events);
+            }
+            inline auto await_resume() const -> void {}
+        };
+
+        template <class C>
+        class OffloadAwaiter : public ReactorWaiter
+        {
+        private:
+            Reactor &reactor;
+            const C &callable;
+
+        public:
+            inline OffloadAwaiter(Reactor &p_reactor, const C &p_callable) : ReactorWaiter{-1, nullptr}, reactor(p_reactor), callable(p_callable) {}
+            inline auto await_ready() const -> B { return false; }
+            inline auto await_suspend(std::coroutine_handle<> p_handle) -> void
+            {
+                handle = p_handle;
+                reactor.waiting++;
+                reactor.offloaded.spawn([this]()
+                                        {
+                                            callable();
+                                            reactor.complete(this); });
+            }
+            inline auto await_resume() const -> void {}
+        };
+
+    private:
+        I epoll_descriptor;
+        I event_descriptor;
+        Size waiting;
+        Mutex completed_lock;
+        List<ReactorWaiter *> completed;
+        TaskGroup offloaded;
+
+        /// Reads and writes on watched descriptors must never block the loop, whatever kind of descriptor they are.
+        static auto require_nonblocking(I p_descriptor) -> void
+        {
+            const auto flags = fcntl(p_descriptor, F_GETFL);
+            if (flags < 0)
+                throw Exception<RUNTIME>("Unable to get descriptor flags.");
+            if ((flags & O_NONBLOCK) == 0)
+                throw Exception<LOGICAL>("Given descriptor is not non-blocking.");
+        }
+
+        auto watch(ReactorWaiter *p_waiter, U32 p_events) -> void
+        {
+            epoll_event event = {};
+            event.events = p_events;
+            event.data.ptr = p_waiter;
+            if (epoll_ctl(epoll_descriptor, EPOLL_CTL_ADD, p_waiter->descriptor, &event) != 0)
+                throw Exception<RUNTIME>(errno == EEXIST ? "Descriptor is already awaited." : "Unable to watch descriptor.");
+            waiting++;
+        }
+
+        /// Called from scheduler threads once offloaded work is done.
+        auto complete(ReactorWaiter *p_waiter) -> void
+        {
+            {
+                auto guard = MutexGuard(completed_lock);
+                completed.append(p_waiter);
+            }
+            const U64 signal = 1;
+            if (::write(event_descriptor, &signal, sizeof(signal)) != sizeof(signal))
+                throw Exception<RUNTIME>("Unable to signal reactor.");
+        }
+
+        auto resume_completed() -> void
+        {
+            U64 signal = 0;
+            if (::read(event_descriptor, &signal, sizeof(signal)) != sizeof(signal))
+                return;
+
+            auto ready = List<ReactorWaiter *>();
+            {
+                auto guard = MutexGuard(completed_lock);
+                ready = move(completed);
+            }
+            for (Size i = 0; i < ready.get_count(); i++)
+            {
+                waiting--;
+                ready[i]->handle.resume();
+            }
+        }
+
+        /// Waits for and dispatches one batch of events.
+        auto poll() -> void
+        {
+            if (waiting == 0)
+                throw Exception<LOGICAL>("Task is suspended on nothing the reactor can wake.");
+
+            epoll_event events[EVENT_CAPACITY];
+            const auto ready_count = epoll_wait(epoll_descriptor, events, EVENT_CAPACITY, -1);
+            if (ready_count < 0)
+            {
+                if (errno == EINTR)
+                    return;
+                throw Exception<RUNTIME>("Unable to wait for events.");
+            }
+
+            for (I i = 0; i < ready_count; i++)
+            {
+                auto waiter = static_cast<ReactorWaiter *>(events[i].data.ptr);
+                if (waiter == nullptr)
+                {
+                    resume_completed();
+                    continue;
+                }
+                epoll_ctl(epoll_descriptor, EPOLL_CTL_DEL, waiter->descriptor, nullptr);
+                waiting--;
+                waiter->handle.resume();
+            }
+        }
+
+    public:
+        Reactor(Scheduler &p_scheduler = Scheduler::get_default()) : epoll_descriptor(-1), event_descriptor(-1), waiting(0), offloaded(p_scheduler)
+        {
+            epoll_descriptor = epoll_create1(EPOLL_CLOEXEC);
+            if (epoll_descriptor < 0)
+                throw Exception<RUNTIME>("Unable to create epoll instance.");
+            event_descriptor = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+            if (event_descriptor < 0)
+            {
+                close(epoll_descriptor);
+                throw Exception<RUNTIME>("Unable to create eventfd.");
+            }
+
+            epoll_event event = {};
+            event.events = EPOLLIN;
+            event.data.ptr = nullptr;
+            epoll_ctl(epoll_descriptor, EPOLL_CTL_ADD, event_descriptor, &event);
+        }
+
+        Reactor(const Reactor &p_reactor) = delete;
+        Reactor(Reactor &&p_reactor) = delete;
+
+        ~Reactor()
+        {
+            offloaded.sync();
+            close(event_descriptor);
+            close(epoll_descriptor);
+        }
+
+        /// Drives `p_task` to completion on the calling thread and returns its result.
+        template <class T, template <class E> class A>
+        auto run(Task<T, A> p_task) -> T
+        {
+            p_task.start();
+            while (!p_task.is_done())
+                poll();
+            return p_task.take_result();
+        }
+
+        inline auto readable(I p_descriptor) -> ReadinessAwaiter { return ReadinessAwaiter(*this, p_descriptor, EPOLLIN); }
+        inline auto writable(I p_descriptor) -> ReadinessAwaiter { return ReadinessAwaiter(*this, p_descriptor, EPOLLOUT); }
+
+        /// Runs `p_callable` on the scheduler and resumes the awaiting coroutine on the reactor thread afterwards.
+        template <class C>
+        inline auto offload(const C &p_callable) -> OffloadAwaiter<C> { return OffloadAwaiter<C>(*this, p_callable); }
+
+        /// Appends at most `p_max_count` bytes from a pollable descriptor to `p_buffer`; 0 means end of stream.
+        auto read(I p_descriptor, List<U8> &p_buffer, Size p_max_count) -> Task<Size>
+        {
+            require_nonblocking(p_descriptor);
+            const auto old_count = p_buffer.get_count();
+            while (true)
+            {
+                p_buffer.resize(old_count + p_max_count);
+                const auto read_count = ::read(p_descriptor, p_buffer.access_data() + old_count, p_max_count);
+                p_buffer.resize(old_count + (read_count > 0 ? read_count : 0));
+                if (read_count >= 0)
+                    co_return read_count;
+                if (errno == EAGAIN || errno == EWOULDBLOCK)
+                    co_await readable(p_descriptor);
+                else if (errno != EINTR)
+                    throw Exception<RUNTIME>("Unable to read from descriptor.");
+            }
+        }
+
+        /// Writes all of `p_data` to a pollable descriptor, as much as the kernel takes each time, waiting for room in between.
+        auto write(I p_descriptor, ListView<U8> p_data) -> Task<Size>
+        {
+            require_nonblocking(p_descriptor);
+            Size written = 0;
+            while (written < p_data.get_count())
+            {
+                const auto write_count = ::write(p_descriptor, p_data.view_data() + written, p_data.get_count() - written);
+                if (write_count >= 0)
+                    written += write_count;
+                else if (errno == EAGAIN || errno == EWOULDBLOCK)
+                    co_await writable(p_descriptor);
+                else if (errno != EINTR)
+                    throw Exception<RUNTIME>("Unable to write to descriptor.");
+            }
+            co_return written;
+        }
+
+        /// Appends up to `p_count` bytes of a regular file at `p_offset` to `p_buffer` using a scheduler thread.
+        auto read_at(I p_descriptor, Size p_offset, List<U8> &p_buffer, Size p_count) -> Task<Size>
+        {
+            const auto old_count = p_buffer.get_count();
+            p_buffer.resize(old_count + p_count);
+            auto target = p_buffer.access_data() + old_count;
+            I64 read_count = 0;
+            co_await offload([&]()
+                             { read_count = pread(p_descriptor, target, p_count, p_offset); });
+
+            p_buffer.resize(old_count + (read_count > 0 ? read_count : 0));
+            if (read_count < 0)
+                throw Exception<RUNTIME>("Unable to read from file.");
+            co_return read_count;
+        }
+    };
+
+} // namespace Rong
+
+#endif // RG_CORE_REACTOR_HPP
\ No newline at end of file
@@ -0,0 +1,121 @@
+#ifndef RG_CORE_RING_BUFFER_HPP
+#define RG_CORE_RING_BUFFER_HPP
+
+#include "def.hpp"
+#include "exception.hpp"
+#include "allocator.hpp"
+#include "list.hpp"
+
+namespace Rong
+{
+    /// Wait-free ring between exactly one producer and one consumer thread.
+    /// Both sides work in place: the producer fills the span returned by `reserve` and publishes it with `commit`,
+    /// the consumer reads the span returned by `acquire` and hands it back with `release`.
+    /// Spans never wrap, so one may be shorter than asked for even when the ring holds more.
+    template <class T, template <class E> class A = Allocator>
+        requires IsAllocatorFeaturesAvailable<A<X>, X>
+    class alignas(CACHE_LINE_SIZE) RingBuffer
+    {
+    public:
+        using ValueType = T;
+        using ElementType = ValueType;
+        using Allocator = A<ElementType>;
+
+    private:
+        ElementType *data;
+        Size capacity;
+
+        /// Each side owns one counter and caches the last value it read of the other's.
+        alignas(CACHE_LINE_SIZE) Size write_position;
+        Size cached_read_position;
+        alignas(CACHE_LINE_SIZE) Size read_position;
+        Size cached_write_position;
+
+    public:
+        RingBuffer(Size p_capacity) : data(nullptr), capacity(p_capacity), write_position(0), cached_read_position(0), read_position(0), cached_write_position(0)
+        {
+            if (capacity < 2 || (capacity & (capacity - 1)) != 0)
+                throw Exception<LOGICAL>("Ring capacity must be a power of two.");
+            data = Allocator::allocate(capacity);
+        }
+
+        RingBuffer(const RingBuffer &p_ring) = delete;
+        RingBuffer(RingBuffer &&p_ring) = delete;
+
+        ~RingBuffer()
+        {
+            for (Size i = 0; i < capacity; i++)
+                data[i].~ElementType();
+            Allocator::deallocate(data);
+            data = nullptr;
+        }
+
+        inline auto get_capacity() const -> Size { return capacity; }
+
+        /// Producer side. Returns up to `p_count` free slots; an empty span means the ring is full.
+        auto reserve(Size p_count) -> AccessibleListView<ValueType>
+        {
+            auto free_count = capacity - (write_position - cached_read_position);
+            if (free_count < p_count)
+            {
+                cached_read_position = __atomic_load_n(&read_position, __ATOMIC_ACQUIRE);
+                free_count = capacity - (write_position - cached_read_position);
+            }
+
+            const auto offset = write_position & (capacity - 1);
+            const auto contiguous_count = capacity - offset;
+            auto count = p_count < free_count ? p_count : free_count;
+            count = count < contiguous_count ? count : contiguous_count;
+            return AccessibleListView<ValueType>(data + offset, count);
+        }
+
+        /// Producer side. Publishes the first `p_count` slots of the last reserved span.
+        inline auto commit(Size p_count) -> void
+        {
+            __atomic_store_n(&write_position, write_position + p_count, __ATOMIC_RELEASE);
+        }
+
+        /// Producer side. Copies a prefix of `p_values` in; returns how many fit.
+        auto write(const ListView<ValueType> &p_values) -> Size
+        {
+            Size written = 0;
+            while (written < p_values.get_count())
+            {
+                auto span = reserve(p_values.get_count() - written);
+                if (span.get_count() == 0)
+                    break;
+                for (Size i = 0; i < span.get_count(); i++)
+                    span.access_data()[i] = p_values.view_data()[written + i];
+                commit(span.get_count());
+                written += span.get_count();
+            }
+            return written;
+        }
+
+        /// Consumer side. Returns up to `p_count` committed elements; an empty span means the ring is empty.
+        auto acquire(Size p_count) -> ListView<ValueType>
+        {
+            auto ready_count = cached_write_position - read_position;
+            if (ready_count < p_count)
+            {
+                cached_write_position = __atomic_load_n(&write_position, __ATOMIC_ACQUIRE);
+                ready_count = cached_write_position - read_position;
+            }
+
+            const auto offset = read_position & (capacity - 1);
+            const auto contiguous_count = capacity - offset;
+            auto count = p_count < ready_count ? p_count : ready_count;
+            count = count < contiguous_count ? count : contiguous_count;
+            return ListView<ValueType>(data + offset, count);
+        }
+
+        /// Consumer side. Hands the first `p_count` elements of the last acquired span back to the producer.
+        inline auto release(Size p_count) -> void
+        {
+            __atomic_store_n(&read_position, read_position + p_count, __ATOMIC_RELEASE);
+        }
+    };
+
+} // namespace Rong
+
+#endif // RG_CORE_RING_BUFFER_HPP
\ No newline at end of file
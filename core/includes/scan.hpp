@@ -0,0 +1,124 @@
+#ifndef RG_CORE_SCAN_HPP
+#define RG_CORE_SCAN_HPP
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+#include "def.hpp"
+#include "exception.hpp"
+#include "list.hpp"
+
+namespace Rong
+{
+    /// Sets larger than this are matched through a lookup table instead of one vector comparison per member.
+    constexpr const Size FIND_ANY_OF_VECTOR_LIMIT = 8;
+
+    /// Index of the first `p_byte` at or after `p_from`, or the list's count when there is none.
+    inline auto find_byte(const ListView<C> &p_list, C p_byte, Size p_from = 0) -> Size
+    {
+        const auto data = p_list.view_data();
+        const auto count = p_list.get_count();
+        auto i = p_from;
+
+#ifdef __AVX2__
+        const auto wide_needle = _mm256_set1_epi8(p_byte);
+        for (; i + 32 <= count; i += 32)
+        {
+            const U32 mask = _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i)), wide_needle));
+            if (mask != 0)
+                return i + __builtin_ctz(mask);
+        }
+#endif
+#ifdef __SSE2__
+        const auto needle = _mm_set1_epi8(p_byte);
+        for (; i + 16 <= count; i += 16)
+        {
+            const U32 mask = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i)), needle));
+            if (mask != 0)
+                return i + __builtin_ctz(mask);
+        }
+#endif
+
+        for (; i < count; i++)
+            if (data[i] == p_byte)
+                return i;
+        return count;
+    }
+
+    /// Index of the first byte at or after `p_from` that is any of `p_bytes`, or the list's count when there is none.
+    inline auto find_any_of(const ListView<C> &p_list, const ListView<C> &p_bytes, Size p_from = 0) -> Size
+    {
+        const auto data = p_list.view_data();
+        const auto count = p_list.get_count();
+        const auto set = p_bytes.view_data();
+        const auto set_count = p_bytes.get_count();
+        if (set_count == 1)
+            return find_byte(p_list, set[0], p_from);
+        auto i = p_from;
+
+#ifdef __SSE2__
+        if (set_count <= FIND_ANY_OF_VECTOR_LIMIT)
+        {
+            __m128i needles[FIND_ANY_OF_VECTOR_LIMIT];
+            for (Size j = 0; j < set_count; j++)
+                needles[j] = _mm_set1_epi8(set[j]);
+
+            for (; i + 16 <= count; i += 16)
+            {
+                const auto block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i));
+                auto matches = _mm_setzero_si128();
+                for (Size j = 0; j < set_count; j++)
+                    matches = _mm_or_si128(matches, _mm_cmpeq_epi8(block, needles[j]));
+                const U32 mask = _mm_movemask_epi8(matches);
+                if (mask != 0)
+                    return i + __builtin_ctz(mask);
+            }
+        }
+#endif
+
+        B members[256] = {};
+        for (Size j = 0; j < set_count; j++)
+            members[static_cast<U8>(set[j])] = true;
+        for (; i < count; i++)
+            if (members[static_cast<U8>(data[i])])
+                return i;
+        return count;
+    }
+
+    /// Fields between delimiters, including empty ones, so `"a,,b,"` gives four fields; the views point into `p_list`.
+    inline auto split(const ListView<C> &p_list, C p_delimiter) -> List<ListView<C>>
+    {
+        auto fields = List<ListView<C>>();
+        Size begin = 0;
+        while (true)
+        {
+            const auto end = find_byte(p_list, p_delimiter, begin);
+            fields.append(begin == end ? ListView<C>() : list_slice(p_list, begin, end));
+            if (end == p_list.get_count())
+                return fields;
+            begin = end + 1;
+        }
+    }
+
+    /// As `split`, breaking on any of `p_delimiters`.
+    inline auto split(const ListView<C> &p_list, const ListView<C> &p_delimiters) -> List<ListView<C>>
+    {
+        auto fields = List<ListView<C>>();
+        Size begin = 0;
+        while (true)
+        {
+            const auto end = find_any_of(p_list, p_delimiters, begin);
+            fields.append(begin == end ? ListView<C>() : list_slice(p_list, begin, end));
+            if (end == p_list.get_count())
+                return fields;
+            begin = end + 1;
+        }
+    }
+
+} // namespace Rong
+
+#endif // RG_CORE_SCAN_HPP
\ No newline at end of file
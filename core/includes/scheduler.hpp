@@ -0,0 +1,343 @@
+#ifndef RG_CORE_SCHEDULER_HPP
+#define RG_CORE_SCHEDULER_HPP
+
+#include <new>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "def.hpp"
+#include "exception.hpp"
+#include "allocator.hpp"
+#include "list.hpp"
+#include "lock.hpp"
+#include "concurrent_queue.hpp"
+#include "work_stealing_deque.hpp"
+
+namespace Rong
+{
+    class Scheduler;
+    class TaskGroup;
+
+    class ScheduledTask
+    {
+    public:
+        /// Runs the task, then frees it.
+        Function<void, ScheduledTask *> *run;
+        TaskGroup *group;
+    };
+
+    template <class C>
+    class ScheduledTaskClosure : public ScheduledTask
+    {
+    public:
+        using CallableType = C;
+        using Allocator = Rong::Allocator<ScheduledTaskClosure>;
+
+        CallableType callable;
+
+        ScheduledTaskClosure(TaskGroup *p_group, const CallableType &p_callable) : ScheduledTask{invoke, p_group}, callable(p_callable) {}
+
+        static auto create(TaskGroup *p_group, const CallableType &p_callable) -> ScheduledTask *
+        {
+            return ::new (Allocator::allocate()) ScheduledTaskClosure(p_group, p_callable);
+        }
+
+        static auto invoke(ScheduledTask *p_task) -> void
+        {
+            auto closure = static_cast<ScheduledTaskClosure *>(p_task);
+            closure->callable();
+            closure->~ScheduledTaskClosure();
+            Allocator::deallocate(closure);
+        }
+    };
+
+    /// Pool of worker threads that balance fork/join work by stealing from each other's deques.
+    /// Tasks must not throw: there is no thread to rethrow into.
+    class Scheduler
+    {
+    public:
+        static constexpr const Size INJECTED_CAPACITY = 4096;
+        static constexpr const Size IDLE_SPIN_COUNT = 64;
+        /// Smallest slice `parallel_for` splits down to is the range divided by this many per worker.
+        static constexpr const Size SPLIT_FACTOR = 16;
+
+    private:
+        class alignas(CACHE_LINE_SIZE) Worker
+        {
+        public:
+            WorkStealingDeque<ScheduledTask *> deque;
+            Scheduler *scheduler;
+            pthread_t thread;
+            U32 seed;
+        };
+
+        static inline thread_local Worker *current = nullptr;
+
+        Worker *workers;
+        Size worker_count;
+        ConcurrentQueue<ScheduledTask *> injected;
+        B running;
+        Size sleeping;
+        pthread_mutex_t idle_lock;
+        pthread_cond_t idle_condition;
+
+        inline auto get_current() const -> Worker * { return current != nullptr && current->scheduler == this ? current : nullptr; }
+
+        static auto execute(ScheduledTask *p_task) -> void;
+
+        /// Runs one task from the own deque, another worker's deque or the injected queue; returns false if none was found.
+        auto run_one(Worker *p_worker) -> B
+        {
+            ScheduledTask *task = nullptr;
+            if (p_worker != nullptr && p_worker->deque.pop(task))
+            {
+                execute(task);
+                return true;
+            }
+
+            U32 seed = p_worker != nullptr ? p_worker->seed : static_cast<U32>(reinterpret_cast<Size>(&task) >> 4);
+            for (Size attempt = 0; attempt < worker_count; attempt++)
+            {
+                seed ^= seed << 13;
+                seed ^= seed >> 17;
+                seed ^= seed << 5;
+                auto &victim = workers[seed % worker_count];
+                if (&victim != p_worker && victim.deque.steal(task))
+                {
+                    if (p_worker != nullptr)
+                        p_worker->seed = seed;
+                    execute(task);
+                    return true;
+                }
+            }
+            if (p_worker != nullptr)
+                p_worker->seed = seed;
+
+            if (injected.dequeue(task))
+            {
+                execute(task);
+                return true;
+            }
+            return false;
+        }
+
+        static auto work(void *p_worker) -> void *
+        {
+            auto worker = static_cast<Worker *>(p_worker);
+            auto scheduler = worker->scheduler;
+            current = worker;
+
+            Size idle_count = 0;
+            while (__atomic_load_n(&scheduler->running, __ATOMIC_ACQUIRE))
+            {
+                if (scheduler->run_one(worker))
+                {
+                    idle_count = 0;
+                    continue;
+                }
+                if (++idle_count < IDLE_SPIN_COUNT)
+                {
+                    sched_yield();
+                    continue;
+                }
+
+                // A wake-up can be missed between the last look and the wait, so the wait is bounded.
+                timespec deadline;
+                clock_gettime(CLOCK_REALTIME, &deadline);
+                deadline.tv_nsec += 1000000;
+                if (deadline.tv_nsec >= 1000000000)
+                {
+                    deadline.tv_sec++;
+                    deadline.tv_nsec -= 1000000000;
+                }
+                pthread_mutex_lock(&scheduler->idle_lock);
+                __atomic_add_fetch(&scheduler->sleeping, 1, __ATOMIC_SEQ_CST);
+                if (__atomic_load_n(&scheduler->running, __ATOMIC_ACQUIRE))
+                    pthread_cond_timedwait(&scheduler->idle_condition, &scheduler->idle_lock, &deadline);
+                __atomic_sub_fetch(&scheduler->sleeping, 1, __ATOMIC_SEQ_CST);
+                pthread_mutex_unlock(&scheduler->idle_lock);
+            }
+
+            current = nullptr;
+            return nullptr;
+        }
+
+        template <class C>
+        auto for_range(TaskGroup &p_group, Size p_begin, Size p_end, Size p_grain, const C &p_callable) -> void;
+
+    public:
+        /// `p_worker_count` of 0 starts one worker per online processor.
+        Scheduler(Size p_worker_count = 0) : workers(nullptr), worker_count(p_worker_count), injected(INJECTED_CAPACITY), running(true), sleeping(0)
+        {
+            if (worker_count == 0)
+            {
+                const auto processor_count = sysconf(_SC_NPROCESSORS_ONLN);
+                worker_count = processor_count > 0 ? processor_count : 1;
+            }
+
+            pthread_mutex_init(&idle_lock, nullptr);
+            pthread_cond_init(&idle_condition, nullptr);
+            // Array new honours the cache-line alignment of `Worker`, which `Allocator` does not guarantee.
+            workers = new Worker[worker_count]();
+            for (Size i = 0; i < worker_count; i++)
+            {
+                workers[i].scheduler = this;
+                workers[i].seed = static_cast<U32>(hash(i)) | 1;
+            }
+            for (Size i = 0; i < worker_count; i++)
+                if (pthread_create(&workers[i].thread, nullptr, work, workers + i) != 0)
+                    throw Exception<RUNTIME>("Unable to start worker thread.");
+        }
+
+        Scheduler(const Scheduler &p_scheduler) = delete;
+        Scheduler(Scheduler &&p_scheduler) = delete;
+
+        ~Scheduler()
+        {
+            __atomic_store_n(&running, false, __ATOMIC_RELEASE);
+            pthread_mutex_lock(&idle_lock);
+            pthread_cond_broadcast(&idle_condition);
+            pthread_mutex_unlock(&idle_lock);
+            for (Size i = 0; i < worker_count; i++)
+                pthread_join(workers[i].thread, nullptr);
+            delete[] workers;
+            pthread_cond_destroy(&idle_condition);
+            pthread_mutex_destroy(&idle_lock);
+        }
+
+        /// Process-wide scheduler with one worker per processor, started on first use.
+        static auto get_default() -> Scheduler &
+        {
+            static Scheduler scheduler;
+            return scheduler;
+        }
+
+        inline auto get_worker_count() const -> Size { return worker_count; }
+
+        /// Queues `p_task` on the calling worker's deque, or on the shared queue for outside threads.
+        auto submit(ScheduledTask *p_task) -> void
+        {
+            auto worker = get_current();
+            if (worker != nullptr)
+                worker->deque.push(p_task);
+            else if (!injected.enqueue(p_task))
+            {
+                execute(p_task);
+                return;
+            }
+
+            if (__atomic_load_n(&sleeping, __ATOMIC_SEQ_CST) != 0)
+                pthread_cond_signal(&idle_condition);
+        }
+
+        /// Runs a pending task on the calling thread; used by waiters so they help instead of blocking.
+        inline auto help() -> B { return run_one(get_current()); }
+
+        /// Calls `p_callable(index, element)` for every element of `p_values`, splitting the range only while
+        /// the calling worker's deque is empty, i.e. while idle workers may be waiting to steal.
+        template <class T, class C>
+        auto parallel_for(const ListView<T> &p_values, const C &p_callable) -> void;
+
+        /// Calls `p_callable(index)` for every index in `[0, p_count)`.
+        template <class C>
+        auto parallel_for(Size p_count, const C &p_callable) -> void;
+    };
+
+    /// Fork/join scope: tasks spawned through it are all finished once `sync` returns.
+    class TaskGroup
+    {
+    private:
+        Scheduler &scheduler;
+        Size pending;
+
+    public:
+        TaskGroup(Scheduler &p_scheduler = Scheduler::get_default()) : scheduler(p_scheduler), pending(0) {}
+        TaskGroup(const TaskGroup &p_group) = delete;
+        TaskGroup(TaskGroup &&p_group) = delete;
+
+        ~TaskGroup()
+        {
+            sync();
+        }
+
+        inline auto get_scheduler() const -> Scheduler & { return scheduler; }
+
+        template <class C>
+        auto spawn(const C &p_callable) -> void
+        {
+            __atomic_add_fetch(&pending, 1, __ATOMIC_RELAXED);
+            scheduler.submit(ScheduledTaskClosure<C>::create(this, p_callable));
+        }
+
+        inline auto finish() -> void { __atomic_sub_fetch(&pending, 1, __ATOMIC_RELEASE); }
+
+        /// Waits for every spawned task, running queued tasks meanwhile.
+        auto sync() -> void
+        {
+            while (__atomic_load_n(&pending, __ATOMIC_ACQUIRE) != 0)
+                if (!scheduler.help())
+                    sched_yield();
+        }
+    };
+
+    inline auto Scheduler::execute(ScheduledTask *p_task) -> void
+    {
+        auto group = p_task->group;
+        p_task->run(p_task);
+        group->finish();
+    }
+
+    template <class C>
+    auto Scheduler::for_range(TaskGroup &p_group, Size p_begin, Size p_end, Size p_grain, const C &p_callable) -> void
+    {
+        while (p_end - p_begin > p_grain)
+        {
+            auto worker = get_current();
+            if (worker == nullptr || worker->deque.get_count() == 0)
+            {
+                const auto middle = p_begin + (p_end - p_begin) / 2;
+                const auto end = p_end;
+                p_group.spawn([this, &p_group, middle, end, p_grain, &p_callable]()
+                              { for_range(p_group, middle, end, p_grain, p_callable); });
+                p_end = middle;
+                continue;
+            }
+
+            // Work is still queued locally, so nobody is starving: keep going sequentially.
+            for (auto i = p_begin; i < p_begin + p_grain; i++)
+                p_callable(i);
+            p_begin += p_grain;
+        }
+
+        for (auto i = p_begin; i < p_end; i++)
+            p_callable(i);
+    }
+
+    template <class C>
+    auto Scheduler::parallel_for(Size p_count, const C &p_callable) -> void
+    {
+        const auto grain = p_count / (worker_count * SPLIT_FACTOR) + 1;
+        auto group = TaskGroup(*this);
+        for_range(group, 0, p_count, grain, p_callable);
+        group.sync();
+    }
+
+    template <class T, class C>
+    auto Scheduler::parallel_for(const ListView<T> &p_values, const C &p_callable) -> void
+    {
+        const auto data = p_values.view_data();
+        parallel_for(p_values.get_count(), [&](Size p_index)
+                     { p_callable(p_index, data[p_index]); });
+    }
+
+    template <class T, class C>
+    inline auto parallel_for(const ListView<T> &p_values, const C &p_callable) -> void { Scheduler::get_default().parallel_for(p_values, p_callable); }
+
+    template <class C>
+    inline auto parallel_for(Size p_count, const C &p_callable) -> void { Scheduler::get_default().parallel_for(p_count, p_callable); }
+
+} // namespace Rong
+
+#endif // RG_CORE_SCHEDULER_HPP
\ No newline at end of file
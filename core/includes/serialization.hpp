@@ -0,0 +1,326 @@
+#ifndef RG_CORE_SERIALIZATION_HPP
+#define RG_CORE_SERIALIZATION_HPP
+
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "def.hpp"
+#include "exception.hpp"
+#include "list.hpp"
+#include "pair.hpp"
+#include "tuple.hpp"
+#include "leash.hpp"
+#include "binary_tree.hpp"
+
+namespace Rong
+{
+    static_assert(__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__, "Serialization stores raw values as little-endian and expects the host to match.");
+
+    constexpr const U32 SERIALIZATION_MAGIC = 0x53424752; // "RGBS" read little-endian.
+    constexpr const U32 SERIALIZATION_VERSION = 1;
+
+    /// Types encoded as their own bytes, which lets lists of them be copied in bulk and viewed without copying.
+    template <class T>
+    struct RawSerializable : Item<B, IsTriviallyCopyable<T>>
+    {
+    };
+
+    /// Pairs and tuples are encoded field by field so padding never reaches the stream.
+    template <class T, class W>
+    struct RawSerializable<Pair<T, W>> : FalseItem
+    {
+    };
+
+    template <class... T>
+    struct RawSerializable<Tuple<T...>> : FalseItem
+    {
+    };
+
+    /// Addresses mean nothing once reloaded.
+    template <class T>
+    struct RawSerializable<T *> : FalseItem
+    {
+    };
+
+    template <class T>
+    struct RawSerializable<ListView<T>> : FalseItem
+    {
+    };
+
+    template <class T>
+    struct RawSerializable<AccessibleListView<T>> : FalseItem
+    {
+    };
+
+    template <class T>
+    concept IsRawSerializable = RawSerializable<T>::value;
+
+    /// Accumulates an encoded stream, starting with the format header.
+    class BinaryWriter
+    {
+    private:
+        List<U8> bytes;
+
+    public:
+        BinaryWriter() : bytes()
+        {
+            write_bytes(&SERIALIZATION_MAGIC, sizeof(SERIALIZATION_MAGIC));
+            write_bytes(&SERIALIZATION_VERSION, sizeof(SERIALIZATION_VERSION));
+        }
+
+        inline auto get_count() const -> Size { return bytes.get_count(); }
+        inline auto view() const -> ListView<U8> { return bytes; }
+        inline auto take() -> List<U8> { return move(bytes); }
+
+        auto write_bytes(const void *p_data, Size p_count) -> void
+        {
+            if (p_count == 0)
+                return;
+            const auto old_count = bytes.get_count();
+            bytes.resize(old_count + p_count);
+            memcpy(bytes.access_data() + old_count, p_data, p_count);
+        }
+
+        /// Zero-fills up to the next multiple of `p_alignment` counted from the start of the stream.
+        auto pad(Size p_alignment) -> void
+        {
+            const auto remainder = bytes.get_count() % p_alignment;
+            if (remainder != 0)
+                bytes.resize(bytes.get_count() + p_alignment - remainder);
+        }
+
+        auto save(const C *p_path) const -> void
+        {
+            const auto descriptor = open(p_path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+            if (descriptor < 0)
+                throw Exception<RUNTIME>("Unable to open file for saving.");
+
+            Size written = 0;
+            while (written < bytes.get_count())
+            {
+                const auto write_count = write(descriptor, bytes.view_data() + written, bytes.get_count() - written);
+                if (write_count <= 0)
+                {
+                    close(descriptor);
+                    throw Exception<RUNTIME>("Unable to write serialized data.");
+                }
+                written += write_count;
+            }
+            close(descriptor);
+        }
+    };
+
+    /// Decodes a stream in place; the bytes, e.g. a `MappedList<U8>`, must outlive every view taken from it.
+    class BinaryReader
+    {
+    private:
+        ListView<U8> bytes;
+        Size position;
+        U32 version;
+
+    public:
+        BinaryReader(const ListView<U8> &p_bytes) : bytes(p_bytes), position(0), version(0)
+        {
+            U32 magic = 0;
+            read_bytes(&magic, sizeof(magic));
+            if (magic != SERIALIZATION_MAGIC)
+                throw Exception<RUNTIME>("Given data is not a serialized stream.");
+            read_bytes(&version, sizeof(version));
+            if (version == 0 || version > SERIALIZATION_VERSION)
+                throw Exception<RUNTIME>("Serialized stream version is not supported.");
+        }
+
+        inline auto get_version() const -> U32 { return version; }
+        inline auto get_position() const -> Size { return position; }
+        inline auto get_remaining_count() const -> Size { return bytes.get_count() - position; }
+        inline auto is_finished() const -> B { return position == bytes.get_count(); }
+
+        /// Points at the next `p_count` bytes and consumes them.
+        auto view_bytes(Size p_count) -> const U8 *
+        {
+            if (p_count > get_remaining_count())
+                throw Exception<RUNTIME>("Serialized stream is truncated.");
+            const auto viewed = bytes.view_data() + position;
+            position += p_count;
+            return viewed;
+        }
+
+        inline auto read_bytes(void *p_target, Size p_count) -> void
+        {
+            if (p_count != 0)
+                memcpy(p_target, view_bytes(p_count), p_count);
+        }
+
+        inline auto skip_padding(Size p_alignment) -> void
+        {
+            const auto remainder = position % p_alignment;
+            if (remainder != 0)
+                view_bytes(p_alignment - remainder);
+        }
+
+        /// Reads an element count and rejects counts the remaining bytes cannot hold, as every element takes at least one byte.
+        auto read_count() -> Size
+        {
+            U64 count = 0;
+            read_bytes(&count, sizeof(count));
+            if (count > get_remaining_count())
+                throw Exception<RUNTIME>("Serialized stream is truncated.");
+            return count;
+        }
+    };
+
+    template <class T>
+    auto deserialize_value(BinaryReader &p_reader) -> T;
+
+    template <class T>
+        requires IsRawSerializable<T>
+    inline auto serialize(BinaryWriter &p_writer, const T &p_value) -> void
+    {
+        p_writer.write_bytes(&p_value, sizeof(T));
+    }
+
+    template <class T>
+        requires IsRawSerializable<T>
+    inline auto deserialize(BinaryReader &p_reader, T &p_value) -> void
+    {
+        p_reader.read_bytes(&p_value, sizeof(T));
+    }
+
+    template <class T, class W>
+    inline auto serialize(BinaryWriter &p_writer, const Pair<T, W> &p_pair) -> void
+    {
+        serialize(p_writer, p_pair.first);
+        serialize(p_writer, p_pair.second);
+    }
+
+    template <class T, class W>
+    inline auto deserialize(BinaryReader &p_reader, Pair<T, W> &p_pair) -> void
+    {
+        deserialize(p_reader, p_pair.first);
+        deserialize(p_reader, p_pair.second);
+    }
+
+    template <Size Index = 0, class... T>
+    inline auto serialize(BinaryWriter &p_writer, const Tuple<T...> &p_tuple) -> void
+    {
+        if constexpr (Index < sizeof...(T))
+        {
+            serialize(p_writer, p_tuple.template get<Index>());
+            serialize<Index + 1>(p_writer, p_tuple);
+        }
+    }
+
+    template <class... T>
+    inline auto deserialize(BinaryReader &p_reader, Tuple<T...> &p_tuple) -> void
+    {
+        // Braced initialization evaluates left to right, matching the write order.
+        p_tuple = Tuple<T...>{deserialize_value<T>(p_reader)...};
+    }
+
+    /// Count, then elements; raw elements are aligned to their type within the stream and copied in one go.
+    template <class T>
+    auto serialize(BinaryWriter &p_writer, const ListView<T> &p_list) -> void
+    {
+        const U64 count = p_list.get_count();
+        p_writer.write_bytes(&count, sizeof(count));
+        if constexpr (IsRawSerializable<T>)
+        {
+            p_writer.pad(alignof(T));
+            p_writer.write_bytes(p_list.view_data(), count * sizeof(T));
+        }
+        else
+        {
+            for (Size i = 0; i < count; i++)
+                serialize(p_writer, p_list.view_data()[i]);
+        }
+    }
+
+    template <class T>
+    inline auto serialize(BinaryWriter &p_writer, const List<T> &p_list) -> void { serialize(p_writer, ListView<T>(p_list)); }
+
+    /// Replaces the content of `p_list`, reusing its storage and, for nested containers, its elements' storage.
+    template <class T>
+    auto deserialize(BinaryReader &p_reader, List<T> &p_list) -> void
+    {
+        const auto count = p_reader.read_count();
+        if constexpr (IsRawSerializable<T>)
+        {
+            p_reader.skip_padding(alignof(T));
+            if (count > p_reader.get_remaining_count() / sizeof(T))
+                throw Exception<RUNTIME>("Serialized stream is truncated.");
+            p_list.resize(count);
+            p_reader.read_bytes(p_list.access_data(), count * sizeof(T));
+        }
+        else
+        {
+            p_list.resize(count);
+            for (Size i = 0; i < count; i++)
+                deserialize(p_reader, p_list.access_data()[i]);
+        }
+    }
+
+    /// Zero-copy counterpart of `deserialize` for raw lists: the view points straight into the reader's bytes.
+    template <class T>
+        requires IsRawSerializable<T>
+    auto deserialize_view(BinaryReader &p_reader) -> ListView<T>
+    {
+        const auto count = p_reader.read_count();
+        p_reader.skip_padding(alignof(T));
+        if (count > p_reader.get_remaining_count() / sizeof(T))
+            throw Exception<RUNTIME>("Serialized stream is truncated.");
+        const auto data = p_reader.view_bytes(count * sizeof(T));
+        if (reinterpret_cast<Size>(data) % alignof(T) != 0)
+            throw Exception<LOGICAL>("Serialized data is misaligned in memory for the element type.");
+        return ListView<T>(reinterpret_cast<const T *>(data), count);
+    }
+
+    /// Count, then entries in ascending key order, so reading rebuilds a balanced tree in linear time.
+    template <class K, class V, template <class E> class A>
+    auto serialize(BinaryWriter &p_writer, const BinaryTree<K, V, A> &p_tree) -> void
+    {
+        const U64 count = p_tree.get_count();
+        p_writer.write_bytes(&count, sizeof(count));
+        p_tree.for_each([&](const K &p_key, const V &p_value)
+                        {
+                            serialize(p_writer, p_key);
+                            serialize(p_writer, p_value); });
+    }
+
+    /// An empty leash is written as an empty tree.
+    template <class K, class V, template <class E> class A, auto D>
+    auto serialize(BinaryWriter &p_writer, const Leash<BinaryTree<K, V, A>, D> &p_tree) -> void
+    {
+        if (p_tree)
+            return serialize(p_writer, **p_tree);
+        const U64 count = 0;
+        p_writer.write_bytes(&count, sizeof(count));
+    }
+
+    template <class K, class V, template <class E> class A, auto D>
+    auto deserialize(BinaryReader &p_reader, Leash<BinaryTree<K, V, A>, D> &p_tree) -> void
+    {
+        const auto count = p_reader.read_count();
+        auto keys = List<K>(count);
+        auto values = List<V>(count);
+        keys.resize(count);
+        values.resize(count);
+        for (Size i = 0; i < count; i++)
+        {
+            deserialize(p_reader, keys.access_data()[i]);
+            deserialize(p_reader, values.access_data()[i]);
+        }
+        p_tree = BinaryTree<K, V, A>::from_sorted(keys, values);
+    }
+
+    template <class T>
+    auto deserialize_value(BinaryReader &p_reader) -> T
+    {
+        auto value = T();
+        deserialize(p_reader, value);
+        return value;
+    }
+
+} // namespace Rong
+
+#endif // RG_CORE_SERIALIZATION_HPP
\ No newline at end of file
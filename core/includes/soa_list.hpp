@@ -0,0 +1,295 @@
+#ifndef RG_CORE_SOA_LIST_HPP
+#define RG_CORE_SOA_LIST_HPP
+
+#include <string.h>
+
+#include "def.hpp"
+#include "exception.hpp"
+#include "allocator.hpp"
+#include "list.hpp"
+#include "tuple.hpp"
+
+namespace Rong
+{
+    /// List of records stored column by column: field `Index` of every row sits in one contiguous array,
+    /// so scanning a single field touches only that field's memory. Rows are read and written as `Tuple`s of references.
+    template <template <class E> class A, class... T>
+        requires(sizeof...(T) > 0) && IsAllocatorFeaturesAvailable<A<X>, X>
+    class AllocatedSoAList
+    {
+    public:
+        using KeyType = Size;
+        using ValueType = Tuple<T...>;
+        using ReferenceType = Tuple<T &...>;
+        using ConstantReferenceType = Tuple<const T &...>;
+        template <Size Index>
+        using ColumnType = TypeAt<Index, T...>::Type;
+        static constexpr const Size COLUMN_COUNT = sizeof...(T);
+        static constexpr const Size INITIAL_CAPACITY = 16;
+
+        class Iterator
+        {
+        public:
+            using ContainerType = AllocatedSoAList;
+            using KeyType = ContainerType::KeyType;
+            using ValueType = ContainerType::ConstantReferenceType;
+
+        private:
+            const ContainerType &container;
+            KeyType current_key;
+
+        public:
+            inline Iterator(const ContainerType &p_container, KeyType p_starting_key = 0) : container(p_container), current_key(p_starting_key) {}
+            inline auto operator*() const -> ValueType { return container[current_key]; }
+            inline auto operator++() -> Iterator
+            {
+                ++current_key;
+                return *this;
+            }
+            inline auto operator--() -> Iterator
+            {
+                --current_key;
+                return *this;
+            }
+            inline auto operator==(const Iterator &p_right) const -> B { return &container == &p_right.container && current_key == p_right.current_key; }
+        };
+
+        class AccessibleIterator
+        {
+        public:
+            using ContainerType = AllocatedSoAList;
+            using KeyType = ContainerType::KeyType;
+            using ValueType = ContainerType::ReferenceType;
+
+        private:
+            ContainerType &container;
+            KeyType current_key;
+
+        public:
+            inline AccessibleIterator(ContainerType &p_container, KeyType p_starting_key = 0) : container(p_container), current_key(p_starting_key) {}
+            inline auto operator*() const -> ValueType { return container[current_key]; }
+            inline auto operator++() -> AccessibleIterator
+            {
+                ++current_key;
+                return *this;
+            }
+            inline auto operator--() -> AccessibleIterator
+            {
+                --current_key;
+                return *this;
+            }
+            inline auto operator==(const AccessibleIterator &p_right) const -> B { return &container == &p_right.container && current_key == p_right.current_key; }
+        };
+
+    private:
+        using Indices = MakeIndexSequence<COLUMN_COUNT>;
+
+        void *columns[COLUMN_COUNT];
+        Size count;
+        Size capacity;
+
+        template <Size Index>
+        inline auto column_data() const -> ColumnType<Index> * { return static_cast<ColumnType<Index> *>(columns[Index]); }
+
+        template <class R, Size... Index>
+        inline auto row(Size p_index, IndexSequence<Index...>) const -> R { return R(column_data<Index>()[p_index]...); }
+
+        template <Size... Index>
+        inline auto append_row(IndexSequence<Index...>, const T &...p_values) -> void { ((column_data<Index>()[count] = p_values), ...); }
+
+        template <Size... Index>
+        inline auto take_row(Size p_index, IndexSequence<Index...>) -> ValueType { return ValueType(move(column_data<Index>()[p_index])...); }
+
+        template <Size Index>
+        auto grow_column(Size p_capacity) -> void
+        {
+            using ElementType = ColumnType<Index>;
+            auto grown = A<ElementType>::allocate(p_capacity);
+            auto old = column_data<Index>();
+            if (old != nullptr)
+            {
+                for (Size i = 0; i < count; i++)
+                {
+                    grown[i] = move(old[i]);
+                    old[i].~ElementType();
+                }
+                A<ElementType>::deallocate(old);
+            }
+            columns[Index] = grown;
+        }
+
+        template <Size Index>
+        auto copy_column(const AllocatedSoAList &p_list) -> void
+        {
+            const auto source = p_list.template column_data<Index>();
+            auto target = column_data<Index>();
+            for (Size i = 0; i < p_list.count; i++)
+                target[i] = source[i];
+        }
+
+        /// Shifts the rows after `p_index` down by one; the vacated last slot is destroyed and zeroed, as fresh storage would be.
+        template <Size Index>
+        auto close_gap(Size p_index) -> void
+        {
+            using ElementType = ColumnType<Index>;
+            auto data = column_data<Index>();
+            for (auto i = p_index; i + 1 < count; i++)
+                data[i] = move(data[i + 1]);
+            data[count - 1].~ElementType();
+            memset(static_cast<void *>(data + count - 1), 0, sizeof(ElementType));
+        }
+
+        template <Size Index>
+        auto clean_column() -> void
+        {
+            using ElementType = ColumnType<Index>;
+            auto data = column_data<Index>();
+            if (data == nullptr)
+                return;
+            for (Size i = 0; i < count; i++)
+                data[i].~ElementType();
+            A<ElementType>::deallocate(data);
+            columns[Index] = nullptr;
+        }
+
+        template <Size... Index>
+        inline auto for_columns(IndexSequence<Index...>, const auto &p_callable) -> void { (p_callable.template operator()<Index>(), ...); }
+
+    public:
+        AllocatedSoAList() : columns{}, count(0), capacity(0) {}
+
+        AllocatedSoAList(Size p_min_capacity) : AllocatedSoAList() { reserve(p_min_capacity); }
+
+        AllocatedSoAList(const AllocatedSoAList &p_list) : AllocatedSoAList(p_list.count)
+        {
+            for_columns(Indices(), [&]<Size Index>()
+                        { copy_column<Index>(p_list); });
+            count = p_list.count;
+        }
+
+        AllocatedSoAList(AllocatedSoAList &&p_list) : AllocatedSoAList()
+        {
+            memcpy(columns, p_list.columns, sizeof(columns));
+            count = p_list.count;
+            capacity = p_list.capacity;
+            memset(p_list.columns, 0, sizeof(p_list.columns));
+            p_list.count = 0;
+            p_list.capacity = 0;
+        }
+
+        ~AllocatedSoAList()
+        {
+            clean();
+        }
+
+        auto operator=(const AllocatedSoAList &p_list) -> AllocatedSoAList &
+        {
+            if (this == &p_list)
+                return *this;
+            clean();
+            reserve(p_list.count);
+            for_columns(Indices(), [&]<Size Index>()
+                        { copy_column<Index>(p_list); });
+            count = p_list.count;
+            return *this;
+        }
+
+        auto operator=(AllocatedSoAList &&p_list) -> AllocatedSoAList &
+        {
+            if (this == &p_list)
+                return *this;
+            clean();
+            memcpy(columns, p_list.columns, sizeof(columns));
+            count = p_list.count;
+            capacity = p_list.capacity;
+            memset(p_list.columns, 0, sizeof(p_list.columns));
+            p_list.count = 0;
+            p_list.capacity = 0;
+            return *this;
+        }
+
+        inline auto get_count() const -> Size { return count; }
+        inline auto get_capacity() const -> Size { return capacity; }
+
+        /// Every value of field `Index`, contiguous.
+        template <Size Index>
+        inline auto column() const -> ListView<ColumnType<Index>> { return ListView<ColumnType<Index>>(column_data<Index>(), count); }
+        template <Size Index>
+        inline auto access_column() -> AccessibleListView<ColumnType<Index>> { return AccessibleListView<ColumnType<Index>>(column_data<Index>(), count); }
+
+        inline auto cbegin() const -> Iterator { return Iterator(*this); }
+        inline auto cend() const -> Iterator { return Iterator(*this, count); }
+        inline auto begin() -> AccessibleIterator { return AccessibleIterator(*this); }
+        inline auto end() -> AccessibleIterator { return AccessibleIterator(*this, count); }
+
+        template <class C>
+        inline auto for_each(const C &p_callable) const -> void { Rong::for_each<Iterator, const C &, ConstantReferenceType>(p_callable, cbegin(), cend()); }
+
+        auto reserve(Size p_min_capacity) -> void
+        {
+            if (p_min_capacity <= capacity)
+                return;
+
+            auto new_capacity = capacity == 0 ? INITIAL_CAPACITY : capacity;
+            while (new_capacity < p_min_capacity)
+                new_capacity *= 2;
+            for_columns(Indices(), [&]<Size Index>()
+                        { grow_column<Index>(new_capacity); });
+            capacity = new_capacity;
+        }
+
+        auto append(const T &...p_values) -> void
+        {
+            reserve(count + 1);
+            append_row(Indices(), p_values...);
+            count++;
+        }
+
+        /// Removes row `p_index`, keeping the order of the others, and returns its values.
+        auto remove(const KeyType &p_index) -> ValueType
+        {
+            if (p_index >= count)
+                throw Exception<LOGICAL>("Given index is out of bound.");
+
+            auto popped = take_row(p_index, Indices());
+            for_columns(Indices(), [&]<Size Index>()
+                        { close_gap<Index>(p_index); });
+            count--;
+            return popped;
+        }
+
+        auto clean() -> void
+        {
+            for_columns(Indices(), [&]<Size Index>()
+                        { clean_column<Index>(); });
+            count = 0;
+            capacity = 0;
+        }
+
+        inline auto operator[](const KeyType &p_index) -> ReferenceType
+        {
+            if (p_index >= count)
+                throw Exception<LOGICAL>("Given index is beyond list's element count.");
+            return row<ReferenceType>(p_index, Indices());
+        }
+
+        inline auto operator[](const KeyType &p_index) const -> ConstantReferenceType
+        {
+            if (p_index >= count)
+                throw Exception<LOGICAL>("Given index is beyond list's element count.");
+            return row<ConstantReferenceType>(p_index, Indices());
+        }
+    };
+
+    /// The allocator has to precede the column types, so the common heap-backed case gets its own name.
+    template <class... T>
+    using SoAList = AllocatedSoAList<Allocator, T...>;
+
+#ifdef FEATURE_ASSERTION
+    static_assert(IsBidirectionalIterator<SoAList<X, Y>::Iterator, SoAList<X, Y>::ConstantReferenceType>, "`SoAList::Iterator` is malformed.");
+    static_assert(IsBidirectionalIterator<SoAList<X, Y>::AccessibleIterator, SoAList<X, Y>::ReferenceType>, "`SoAList::AccessibleIterator` is malformed.");
+#endif // FEATURE_ASSERTION
+
+} // namespace Rong
+
+#endif // RG_CORE_SOA_LIST_HPP
\ No newline at end of file
@@ -0,0 +1,311 @@
+#ifndef RG_CORE_STRING_HPP
+#define RG_CORE_STRING_HPP
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#include <string.h>
+
+#include "def.hpp"
+#include "exception.hpp"
+#include "allocator.hpp"
+#include "list.hpp"
+#include "scan.hpp"
+
+namespace Rong
+{
+    /// Index of the first occurrence of `p_needle` at or after `p_from`, or `p_count` when there is none.
+    /// Vector blocks test the needle's first and last byte at sixteen positions at once and only `memcmp` positions matching both.
+    inline auto string_find(const C *p_data, Size p_count, const C *p_needle, Size p_needle_count, Size p_from = 0) -> Size
+    {
+        if (p_needle_count == 0)
+            return p_from < p_count ? p_from : p_count;
+        if (p_needle_count == 1)
+            return find_byte(ListView<C>(p_data, p_count), p_needle[0], p_from);
+        if (p_needle_count > p_count || p_from > p_count - p_needle_count)
+            return p_count;
+
+        const auto last_start = p_count - p_needle_count;
+        auto i = p_from;
+
+#ifdef __SSE2__
+        const auto first = _mm_set1_epi8(p_needle[0]);
+        const auto last = _mm_set1_epi8(p_needle[p_needle_count - 1]);
+        for (; i + 16 <= last_start + 1; i += 16)
+        {
+            const auto first_block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p_data + i));
+            const auto last_block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p_data + i + p_needle_count - 1));
+            U32 mask = _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(first_block, first), _mm_cmpeq_epi8(last_block, last)));
+            for (; mask != 0; mask &= mask - 1)
+            {
+                const auto candidate = i + __builtin_ctz(mask);
+                if (memcmp(p_data + candidate + 1, p_needle + 1, p_needle_count - 2) == 0)
+                    return candidate;
+            }
+        }
+#endif
+
+        for (; i <= last_start; i++)
+            if (p_data[i] == p_needle[0] && memcmp(p_data + i + 1, p_needle + 1, p_needle_count - 1) == 0)
+                return i;
+        return p_count;
+    }
+
+    /// Non-owning run of characters; interchangeable with `ListView<C>`.
+    class StringView
+    {
+    public:
+        using KeyType = Size;
+        using ValueType = C;
+        using ElementType = ValueType;
+
+    private:
+        const ElementType *data;
+        Size count;
+
+    public:
+        constexpr StringView() : data(nullptr), count(0) {}
+        constexpr StringView(const ValueType *p_data, Size p_count) : data(p_data), count(p_count) {}
+        inline StringView(const ValueType *p_text) : data(p_text), count(strlen(p_text)) {}
+        constexpr StringView(const ListView<ValueType> &p_list) : data(p_list.view_data()), count(p_list.get_count()) {}
+
+        constexpr auto view_data() const -> const ValueType * { return data; }
+        constexpr auto get_count() const -> Size { return count; }
+
+        constexpr operator ListView<ValueType>() const { return ListView<ValueType>(data, count); }
+
+        inline auto operator==(const StringView &p_right) const -> B { return count == p_right.count && (count == 0 || memcmp(data, p_right.data, count) == 0); }
+
+        /// Unlike `list_slice`, an empty slice at the end is allowed.
+        inline auto slice(const KeyType &p_begin_index, const KeyType &p_end_index) const -> StringView
+        {
+            if (p_end_index > count)
+                throw Exception<LOGICAL>("Given end index beyond string's character count.");
+            if (p_begin_index > p_end_index)
+                throw Exception<LOGICAL>("Begin index is larger than end index.");
+            return StringView(data + p_begin_index, p_end_index - p_begin_index);
+        }
+
+        /// Index of the first occurrence at or after `p_from`, or the count when there is none.
+        inline auto find(const StringView &p_needle, Size p_from = 0) const -> Size { return string_find(data, count, p_needle.data, p_needle.count, p_from); }
+        inline auto find(ValueType p_character, Size p_from = 0) const -> Size { return find_byte(*this, p_character, p_from); }
+        inline auto contains(const StringView &p_needle) const -> B { return find(p_needle) != count; }
+        inline auto starts_with(const StringView &p_prefix) const -> B { return p_prefix.count <= count && (p_prefix.count == 0 || memcmp(data, p_prefix.data, p_prefix.count) == 0); }
+        inline auto ends_with(const StringView &p_suffix) const -> B { return p_suffix.count <= count && (p_suffix.count == 0 || memcmp(data + count - p_suffix.count, p_suffix.data, p_suffix.count) == 0); }
+
+        constexpr auto operator[](const KeyType &p_index) const -> const ValueType &
+        {
+            if (p_index >= count)
+                throw Exception<LOGICAL>("Given index is beyond string's character count.");
+            return data[p_index];
+        }
+    };
+
+    class StringHeap
+    {
+    public:
+        C *data;
+        Size count;
+        Size capacity;
+    };
+
+    /// Owning character string. Up to `INLINE_CAPACITY` characters live inside the object itself, so short strings never allocate.
+    /// Not null-terminated. Zeroed memory is a valid empty string, as with every container allocated through `Allocator`.
+    template <template <class E> class A = Allocator>
+        requires IsAllocatorFeaturesAvailable<A<X>, X>
+    class AllocatedString
+    {
+    public:
+        using KeyType = Size;
+        using ValueType = C;
+        using ElementType = ValueType;
+        using Allocator = A<ValueType>;
+        static constexpr const Size INLINE_CAPACITY = sizeof(StringHeap) - 1;
+
+    private:
+        static_assert(__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__, "The heap flag must share its byte with the inline count.");
+
+        /// Overlaps the top byte of `heap.capacity`, which stays free since capacities never reach 2^63.
+        static constexpr const Size HEAP_FLAG = static_cast<Size>(1) << (sizeof(Size) * 8 - 1);
+        static constexpr const U8 INLINE_COUNT_MASK = 0x7F;
+
+        union
+        {
+            StringHeap heap;
+            ValueType buffer[sizeof(StringHeap)];
+        };
+
+        inline auto is_inline() const -> B { return (static_cast<U8>(buffer[INLINE_CAPACITY]) & ~INLINE_COUNT_MASK) == 0; }
+
+        inline auto set_count(Size p_count) -> void
+        {
+            if (is_inline())
+                buffer[INLINE_CAPACITY] = static_cast<ValueType>(p_count);
+            else
+                heap.count = p_count;
+        }
+
+        inline auto reset() -> void { memset(buffer, 0, sizeof(buffer)); }
+
+        /// Moves to a heap block of `p_capacity` characters and appends `p_tail`, which may point into this string.
+        auto grow(Size p_capacity, const StringView &p_tail) -> void
+        {
+            const auto count = get_count();
+            auto data = Allocator::allocate(p_capacity);
+            memcpy(data, view_data(), count);
+            if (p_tail.get_count() != 0)
+                memcpy(data + count, p_tail.view_data(), p_tail.get_count());
+            clean();
+            heap.data = data;
+            heap.count = count + p_tail.get_count();
+            heap.capacity = p_capacity | HEAP_FLAG;
+        }
+
+    public:
+        AllocatedString() { reset(); }
+        AllocatedString(const StringView &p_text) : AllocatedString() { append(p_text); }
+        AllocatedString(const ValueType *p_text) : AllocatedString(StringView(p_text)) {}
+        AllocatedString(const AllocatedString &p_string) : AllocatedString(p_string.view()) {}
+        AllocatedString(AllocatedString &&p_string)
+        {
+            memcpy(buffer, p_string.buffer, sizeof(buffer));
+            p_string.reset();
+        }
+
+        ~AllocatedString()
+        {
+            clean();
+        }
+
+        auto operator=(const AllocatedString &p_string) -> AllocatedString &
+        {
+            if (this == &p_string)
+                return *this;
+            set_count(0);
+            append(p_string.view());
+            return *this;
+        }
+
+        auto operator=(AllocatedString &&p_string) -> AllocatedString &
+        {
+            if (this == &p_string)
+                return *this;
+            clean();
+            memcpy(buffer, p_string.buffer, sizeof(buffer));
+            p_string.reset();
+            return *this;
+        }
+
+        inline auto view_data() const -> const ValueType * { return is_inline() ? buffer : heap.data; }
+        inline auto access_data() -> ValueType * { return is_inline() ? buffer : heap.data; }
+        inline auto get_count() const -> Size { return is_inline() ? static_cast<U8>(buffer[INLINE_CAPACITY]) : heap.count; }
+        inline auto get_capacity() const -> Size { return is_inline() ? INLINE_CAPACITY : heap.capacity & ~HEAP_FLAG; }
+
+        inline auto view() const -> StringView { return StringView(view_data(), get_count()); }
+        inline operator StringView() const { return view(); }
+        inline operator ListView<ValueType>() const { return ListView<ValueType>(view_data(), get_count()); }
+
+        inline auto operator==(const StringView &p_right) const -> B { return view() == p_right; }
+
+        inline auto slice(const KeyType &p_begin_index, const KeyType &p_end_index) const -> StringView { return view().slice(p_begin_index, p_end_index); }
+        inline auto find(const StringView &p_needle, Size p_from = 0) const -> Size { return view().find(p_needle, p_from); }
+        inline auto find(ValueType p_character, Size p_from = 0) const -> Size { return view().find(p_character, p_from); }
+        inline auto contains(const StringView &p_needle) const -> B { return view().contains(p_needle); }
+        inline auto starts_with(const StringView &p_prefix) const -> B { return view().starts_with(p_prefix); }
+        inline auto ends_with(const StringView &p_suffix) const -> B { return view().ends_with(p_suffix); }
+
+        auto reserve(Size p_min_capacity) -> void
+        {
+            if (p_min_capacity > get_capacity())
+                grow(p_min_capacity, StringView());
+        }
+
+        auto append(const StringView &p_text) -> void
+        {
+            if (p_text.get_count() == 0)
+                return;
+            const auto count = get_count();
+            const auto new_count = count + p_text.get_count();
+            if (new_count > get_capacity())
+                return grow(new_count > get_capacity() * 2 ? new_count : get_capacity() * 2, p_text);
+            memmove(access_data() + count, p_text.view_data(), p_text.get_count());
+            set_count(new_count);
+        }
+
+        inline auto append(ValueType p_character) -> void { append(StringView(&p_character, 1)); }
+
+        /// Copies both sides into one allocation sized up front.
+        inline auto concat(const StringView &p_text) const -> AllocatedString
+        {
+            auto result = AllocatedString();
+            result.reserve(get_count() + p_text.get_count());
+            result.append(view());
+            result.append(p_text);
+            return result;
+        }
+
+        auto clean() -> void
+        {
+            if (!is_inline())
+                Allocator::deallocate(heap.data);
+            reset();
+        }
+
+        inline auto operator[](const KeyType &p_index) -> ValueType &
+        {
+            if (p_index >= get_count())
+                throw Exception<LOGICAL>("Given index is beyond string's character count.");
+            return access_data()[p_index];
+        }
+
+        inline auto operator[](const KeyType &p_index) const -> const ValueType &
+        {
+            if (p_index >= get_count())
+                throw Exception<LOGICAL>("Given index is beyond string's character count.");
+            return view_data()[p_index];
+        }
+    };
+
+    using String = AllocatedString<>;
+
+    /// Joins any number of pieces with a single allocation.
+    template <class... T>
+        requires(IsConvertible<T, StringView> && ...)
+    auto string_concat(const T &...p_parts) -> String
+    {
+        auto result = String();
+        result.reserve((StringView(p_parts).get_count() + ... + 0));
+        (result.append(StringView(p_parts)), ...);
+        return result;
+    }
+
+    /// Lexicographic by bytes, a prefix ordering first.
+    inline auto contrast(const StringView &p_left, const StringView &p_right) -> I
+    {
+        const auto common = p_left.get_count() < p_right.get_count() ? p_left.get_count() : p_right.get_count();
+        const auto byte_contrast = common == 0 ? 0 : memcmp(p_left.view_data(), p_right.view_data(), common);
+        if (byte_contrast != 0)
+            return byte_contrast;
+        return p_left.get_count() < p_right.get_count() ? -1 : p_left.get_count() > p_right.get_count() ? 1
+                                                                                                        : 0;
+    }
+
+    template <template <class E> class A>
+    inline auto contrast(const AllocatedString<A> &p_left, const AllocatedString<A> &p_right) -> I { return contrast(p_left.view(), p_right.view()); }
+    template <template <class E> class A>
+    inline auto contrast(const AllocatedString<A> &p_left, const StringView &p_right) -> I { return contrast(p_left.view(), p_right); }
+    template <template <class E> class A>
+    inline auto contrast(const StringView &p_left, const AllocatedString<A> &p_right) -> I { return contrast(p_left, p_right.view()); }
+
+    /// Matches `hash` of a `List<C>` with the same characters.
+    inline auto hash(const StringView &p_text) -> U64 { return hash_bytes(p_text.view_data(), p_text.get_count()); }
+    template <template <class E> class A>
+    inline auto hash(const AllocatedString<A> &p_text) -> U64 { return hash(p_text.view()); }
+
+#ifdef FEATURE_ASSERTION
+    static_assert(sizeof(String) == 24, "`String` is expected to be three words.");
+#endif // FEATURE_ASSERTION
+
+} // namespace Rong
+
+#endif // RG_CORE_STRING_HPP
\ No newline at end of file
@@ -0,0 +1,139 @@
+#ifndef RG_CORE_TASK_HPP
+#define RG_CORE_TASK_HPP
+
+#include <coroutine>
+
+#include "def.hpp"
+#include "exception.hpp"
+#include "allocator.hpp"
+
+namespace Rong
+{
+    template <class T>
+    class TaskResult
+    {
+    public:
+        using ValueType = T;
+
+        ValueType value;
+
+        inline auto return_value(const ValueType &p_value) -> void { value = p_value; }
+        inline auto take() -> ValueType { return move(value); }
+    };
+
+    template <>
+    class TaskResult<void>
+    {
+    public:
+        using ValueType = void;
+
+        inline auto return_void() -> void {}
+        inline auto take() -> void {}
+    };
+
+    /// Lazy coroutine producing one `T`. It starts when first awaited and, once finished, resumes its awaiter directly.
+    /// Exceptions are not stored: they propagate out of whichever `resume` was running the coroutine.
+    template <class T = void, template <class E> class A = Allocator>
+        requires IsAllocatorFeaturesAvailable<A<X>, X>
+    class Task
+    {
+    public:
+        using ValueType = T;
+        using FrameAllocator = A<U8>;
+
+        class promise_type : public TaskResult<ValueType>
+        {
+        public:
+            std::coroutine_handle<> continuation;
+            /// Set once the body has run, after which it is driven by whatever it suspended on, not by its awaiter.
+            B started = false;
+
+            class FinalAwaiter
+            {
+            public:
+                inline auto await_ready() const noexcept -> B { return false; }
+                inline auto await_suspend(std::coroutine_handle<promise_type> p_handle) noexcept -> std::coroutine_handle<>
+                {
+                    const auto continuation = p_handle.promise().continuation;
+                    return continuation ? continuation : std::noop_coroutine();
+                }
+                inline auto await_resume() noexcept -> void {}
+            };
+
+            static auto operator new(decltype(sizeof(0)) p_size) -> void * { return FrameAllocator::allocate(p_size); }
+            static auto operator delete(void *p_frame) -> void { FrameAllocator::deallocate(static_cast<U8 *>(p_frame)); }
+
+            inline auto get_return_object() -> Task { return Task(std::coroutine_handle<promise_type>::from_promise(*this)); }
+            inline auto initial_suspend() const noexcept -> std::suspend_always { return {}; }
+            inline auto final_suspend() const noexcept -> FinalAwaiter { return {}; }
+            inline auto unhandled_exception() -> void { throw; }
+        };
+
+        using HandleType = std::coroutine_handle<promise_type>;
+
+    private:
+        HandleType handle;
+
+        inline Task(HandleType p_handle) : handle(p_handle) {}
+
+    public:
+        Task(const Task &p_task) = delete;
+        Task(Task &&p_task) : handle(p_task.handle) { p_task.handle = nullptr; }
+
+        ~Task()
+        {
+            if (handle)
+                handle.destroy();
+            handle = nullptr;
+        }
+
+        auto operator=(Task &&p_task) -> Task &
+        {
+            if (this == &p_task)
+                return *this;
+            if (handle)
+                handle.destroy();
+            handle = p_task.handle;
+            p_task.handle = nullptr;
+            return *this;
+        }
+
+        inline auto is_done() const -> B { return handle == nullptr || handle.done(); }
+
+        /// Runs the coroutine up to its first suspension; for top-level tasks driven by an event loop.
+        inline auto start() -> void
+        {
+            if (handle == nullptr || handle.done())
+                throw Exception<LOGICAL>("Task is empty or already finished.");
+            if (handle.promise().started)
+                throw Exception<LOGICAL>("Task has already started.");
+            handle.promise().started = true;
+            handle.resume();
+        }
+
+        inline auto take_result() -> ValueType
+        {
+            if (!is_done() || handle == nullptr)
+                throw Exception<LOGICAL>("Task has not finished.");
+            return handle.promise().take();
+        }
+
+        inline auto await_ready() const -> B { return is_done(); }
+
+        /// A task already `start`ed is parked on whatever it awaits, which will resume it; the awaiter only waits for the final suspend.
+        inline auto await_suspend(std::coroutine_handle<> p_awaiter) -> std::coroutine_handle<>
+        {
+            auto &promise = handle.promise();
+            promise.continuation = p_awaiter;
+            if (promise.started)
+                return std::noop_coroutine();
+            promise.started = true;
+            return handle;
+        }
+
+        inline auto await_resume() -> ValueType { return handle.promise().take(); }
+    };
+
+} // namespace Rong
+
+#endif // RG_CORE_TASK_HPP
\ No newline at end of file
@@ -1,6 +1,8 @@
 #ifndef RG_CORE_TUPLE_HPP
 #define RG_CORE_TUPLE_HPP
 
+#include <utility>
+
 #include "def.hpp"
 
 namespace Rong
@@ -17,7 +19,8 @@ namespace Rong
         ValueType value;
 
     public:
-        constexpr TupleNode(ValueType p_value, V... p_values) : TupleNode<V...>(p_values...), value(p_value) {}
+        constexpr TupleNode() = default;
+        constexpr TupleNode(ValueType p_value, V... p_values) : TupleNode<V...>(static_cast<V &&>(p_values)...), value(static_cast<ValueType &&>(p_value)) {}
     };
 
     template <class T>
@@ -31,33 +34,174 @@ namespace Rong
         ValueType value;
 
     public:
-        constexpr TupleNode(ValueType p_value) : value(p_value) {}
+        constexpr TupleNode() = default;
+        constexpr TupleNode(ValueType p_value) : value(static_cast<ValueType &&>(p_value)) {}
+    };
+
+    /// Storage order of a tuple's members: ascending by alignment, stable, so the innermost `TupleNode` base,
+    /// which comes first in memory, holds the most aligned members and padding only gathers at the end.
+    template <class... T>
+    class TupleLayout
+    {
+    public:
+        static constexpr const Size COUNT = sizeof...(T);
+
+        /// `logical[position]` is the logical index stored at `position`; `positions[index]` is the reverse.
+        Size logical[COUNT];
+        Size positions[COUNT];
+
+        constexpr TupleLayout() : logical{}, positions{}
+        {
+            // A node holding `T` reports the alignment of its actual storage, which for references is a pointer's.
+            const Size alignments[] = {alignof(TupleNode<T>)...};
+            for (Size i = 0; i < COUNT; i++)
+            {
+                auto j = i;
+                for (; j > 0 && alignments[logical[j - 1]] > alignments[i]; j--)
+                    logical[j] = logical[j - 1];
+                logical[j] = i;
+            }
+            for (Size i = 0; i < COUNT; i++)
+                positions[logical[i]] = i;
+        }
+    };
+
+    template <Size Index, class T, class... W>
+    constexpr auto parameter_at(T &&p_first, W &&...p_rest) -> decltype(auto)
+    {
+        if constexpr (Index == 0)
+            return static_cast<T &&>(p_first);
+        else
+            return parameter_at<Index - 1>(static_cast<W &&>(p_rest)...);
+    }
+
+    template <class... T>
+    class TupleStorage : Inconstructible
+    {
+    private:
+        static constexpr const TupleLayout<T...> LAYOUT = TupleLayout<T...>();
+
+        template <Size... Position>
+        static auto sort(IndexSequence<Position...>) -> Parameters<typename TypeAt<LAYOUT.logical[Position], T...>::Type...>;
+
+        template <class P>
+        struct Sorted;
+
+        template <class... S>
+        struct Sorted<Parameters<S...>> : Inconstructible
+        {
+            using Type = TupleNode<S...>;
+            template <Size Position>
+            using Node = TypeAt<Position, S...>::template Set<TupleNode>;
+        };
+
+        using SortedType = Sorted<decltype(sort(MakeIndexSequence<sizeof...(T)>()))>;
+
+    public:
+        using Type = SortedType::Type;
+        /// The node holding logical member `Index`.
+        template <Size Index>
+        using Node = SortedType::template Node<LAYOUT.positions[Index]>;
     };
 
+    /// Fixed group of values addressed by logical index. Members are stored reordered by `TupleLayout` to minimize padding,
+    /// which is invisible through `get`.
     template <class... T>
-    class Tuple : public TupleNode<T...>
+    class Tuple : public TupleStorage<T...>::Type
     {
     public:
         template <Size Index>
         using ValueType = TypeAt<Index, T...>::Type;
 
     private:
+        using StorageType = TupleStorage<T...>::Type;
+        static constexpr const TupleLayout<T...> LAYOUT = TupleLayout<T...>();
+
+        template <Size Index>
+        using NodeType = TupleStorage<T...>::template Node<Index>;
+
+        template <Size... Position>
+        constexpr Tuple(IndexSequence<Position...>, T &...p_values) : StorageType(parameter_at<LAYOUT.logical[Position]>(static_cast<T &&>(p_values)...)...) {}
+
     public:
-        constexpr Tuple(T... p_values) : TupleNode<T...>(p_values...) {}
+        constexpr Tuple() = default;
+        constexpr Tuple(T... p_values) : Tuple(MakeIndexSequence<sizeof...(T)>(), p_values...) {}
+
+        template <Size Index>
+        constexpr auto get() const & -> const ValueType<Index> &
+        {
+            return NodeType<Index>::value;
+        }
+
+        template <Size Index>
+        constexpr auto get() & -> ValueType<Index> &
+        {
+            return NodeType<Index>::value;
+        }
 
         template <Size Index>
-        constexpr auto get() const -> ValueType<Index>
+        constexpr auto get() && -> ValueType<Index> &&
         {
-            return TypeAt<Index, T...>::template Set<TupleNode>::value;
+            return static_cast<ValueType<Index> &&>(NodeType<Index>::value);
+        }
+
+        template <class V>
+        constexpr auto get() const & -> const ValueType<TypeIndex<V, T...>::INDEX> &
+        {
+            return get<TypeIndex<V, T...>::INDEX>();
         }
 
         template <class V>
-        constexpr auto get() const -> ValueType<TypeIndex<V, T...>::INDEX>
+        constexpr auto get() & -> ValueType<TypeIndex<V, T...>::INDEX> &
         {
             return get<TypeIndex<V, T...>::INDEX>();
         }
+
+        template <class V>
+        constexpr auto get() && -> ValueType<TypeIndex<V, T...>::INDEX> &&
+        {
+            return static_cast<Tuple &&>(*this).template get<TypeIndex<V, T...>::INDEX>();
+        }
     };
 
+    template <Size Index = 0, class... T>
+        requires(IsConstrastAvailable<T> && ...)
+    constexpr auto contrast(const Tuple<T...> &p_left, const Tuple<T...> &p_right) -> I
+    {
+        if constexpr (Index == sizeof...(T))
+            return 0;
+        else
+        {
+            const auto element_contrast = contrast(p_left.template get<Index>(), p_right.template get<Index>());
+            if (element_contrast != 0)
+                return element_contrast;
+            return contrast<Index + 1>(p_left, p_right);
+        }
+    }
+
+    template <Size Index = 0, class... T>
+        requires(IsHashAvailable<T> && ...)
+    inline auto hash(const Tuple<T...> &p_tuple, U64 p_seed = HASH_SECRETS[2]) -> U64
+    {
+        if constexpr (Index == sizeof...(T))
+            return p_seed;
+        else
+            return hash<Index + 1>(p_tuple, hash_combine(p_seed, hash(p_tuple.template get<Index>())));
+    }
+
 } // namespace Rong
 
+/// Tuple protocol, so `auto [first, second] = tuple;` binds through `get`.
+template <class... T>
+struct std::tuple_size<Rong::Tuple<T...>>
+{
+    static constexpr const Rong::Size value = sizeof...(T);
+};
+
+template <Rong::Size Index, class... T>
+struct std::tuple_element<Index, Rong::Tuple<T...>>
+{
+    using type = Rong::TypeAt<Index, T...>::Type;
+};
+
 #endif // RG_CORE_TUPLE_HPP
\ No newline at end of file
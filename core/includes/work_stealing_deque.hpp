@@ -0,0 +1,136 @@
+#ifndef RG_CORE_WORK_STEALING_DEQUE_HPP
+#define RG_CORE_WORK_STEALING_DEQUE_HPP
+
+#include "def.hpp"
+#include "allocator.hpp"
+
+namespace Rong
+{
+    template <class T>
+    class WorkStealingDequeArray
+    {
+    public:
+        using ValueType = T;
+
+    private:
+    public:
+        ValueType *slots;
+        I64 capacity;
+        WorkStealingDequeArray *previous;
+
+        inline auto get(I64 p_index) const -> ValueType { return __atomic_load_n(&slots[p_index & (capacity - 1)], __ATOMIC_RELAXED); }
+        inline auto put(I64 p_index, ValueType p_value) -> void { __atomic_store_n(&slots[p_index & (capacity - 1)], p_value, __ATOMIC_RELAXED); }
+    };
+
+    /// Chase-Lev deque: the owning thread pushes and pops at the bottom while any thread may steal from the top.
+    /// `T` must fit in an atomic word, typically a pointer. A zeroed deque is empty and valid.
+    template <class T, template <class E> class A = Allocator>
+        requires IsAllocatorFeaturesAvailable<A<X>, X>
+    class WorkStealingDeque
+    {
+    public:
+        using ValueType = T;
+        using ElementType = WorkStealingDequeArray<ValueType>;
+        using Allocator = A<ElementType>;
+        using SlotAllocator = A<ValueType>;
+        static constexpr const I64 INITIAL_CAPACITY = 64;
+
+    private:
+        alignas(CACHE_LINE_SIZE) I64 top;
+        alignas(CACHE_LINE_SIZE) I64 bottom;
+        ElementType *array;
+
+        /// Thieves may still be reading the old array, so it is kept until the deque is destroyed.
+        auto grow(ElementType *p_array, I64 p_top, I64 p_bottom) -> ElementType *
+        {
+            auto grown = Allocator::allocate();
+            grown->capacity = p_array == nullptr ? INITIAL_CAPACITY : p_array->capacity * 2;
+            grown->slots = SlotAllocator::allocate(grown->capacity);
+            grown->previous = p_array;
+            for (auto i = p_top; i < p_bottom; i++)
+                grown->put(i, p_array->get(i));
+            __atomic_store_n(&array, grown, __ATOMIC_RELEASE);
+            return grown;
+        }
+
+    public:
+        WorkStealingDeque() : top(0), bottom(0), array(nullptr) {}
+        WorkStealingDeque(const WorkStealingDeque &p_deque) = delete;
+        WorkStealingDeque(WorkStealingDeque &&p_deque) = delete;
+
+        ~WorkStealingDeque()
+        {
+            while (array != nullptr)
+            {
+                auto previous = array->previous;
+                SlotAllocator::deallocate(array->slots);
+                Allocator::deallocate(array);
+                array = previous;
+            }
+        }
+
+        /// Approximate unless called by the owner.
+        inline auto get_count() const -> Size
+        {
+            const auto count = __atomic_load_n(&bottom, __ATOMIC_RELAXED) - __atomic_load_n(&top, __ATOMIC_RELAXED);
+            return count > 0 ? count : 0;
+        }
+
+        /// Owner only.
+        auto push(ValueType p_value) -> void
+        {
+            const auto current_bottom = __atomic_load_n(&bottom, __ATOMIC_RELAXED);
+            const auto current_top = __atomic_load_n(&top, __ATOMIC_ACQUIRE);
+            auto current_array = __atomic_load_n(&array, __ATOMIC_RELAXED);
+            if (current_array == nullptr || current_bottom - current_top > current_array->capacity - 1)
+                current_array = grow(current_array, current_top, current_bottom);
+            current_array->put(current_bottom, p_value);
+            __atomic_store_n(&bottom, current_bottom + 1, __ATOMIC_RELEASE);
+        }
+
+        /// Owner only. Takes the most recently pushed element.
+        auto pop(ValueType &p_value) -> B
+        {
+            const auto current_bottom = __atomic_load_n(&bottom, __ATOMIC_RELAXED) - 1;
+            const auto current_array = __atomic_load_n(&array, __ATOMIC_RELAXED);
+            __atomic_store_n(&bottom, current_bottom, __ATOMIC_RELAXED);
+            __atomic_thread_fence(__ATOMIC_SEQ_CST);
+            auto current_top = __atomic_load_n(&top, __ATOMIC_RELAXED);
+
+            if (current_top > current_bottom)
+            {
+                __atomic_store_n(&bottom, current_bottom + 1, __ATOMIC_RELAXED);
+                return false;
+            }
+
+            p_value = current_array->get(current_bottom);
+            if (current_top != current_bottom)
+                return true;
+
+            // Last element: race the thieves for it.
+            const auto won = __atomic_compare_exchange_n(&top, &current_top, current_top + 1, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED);
+            __atomic_store_n(&bottom, current_bottom + 1, __ATOMIC_RELAXED);
+            return won;
+        }
+
+        /// Any thread. Takes the least recently pushed element; fails when empty or when another thread got there first.
+        auto steal(ValueType &p_value) -> B
+        {
+            auto current_top = __atomic_load_n(&top, __ATOMIC_ACQUIRE);
+            __atomic_thread_fence(__ATOMIC_SEQ_CST);
+            const auto current_bottom = __atomic_load_n(&bottom, __ATOMIC_ACQUIRE);
+            if (current_top >= current_bottom)
+                return false;
+
+            const auto current_array = __atomic_load_n(&array, __ATOMIC_ACQUIRE);
+            const auto value = current_array->get(current_top);
+            if (!__atomic_compare_exchange_n(&top, &current_top, current_top + 1, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED))
+                return false;
+            p_value = value;
+            return true;
+        }
+    };
+
+} // namespace Rong
+
+#endif // RG_CORE_WORK_STEALING_DEQUE_HPP
\ No newline at end of file
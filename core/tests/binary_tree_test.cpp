@@ -22,3 +22,243 @@ TEST_CASE("Binary Tree Base Feature")
     REQUIRE(tree[14] == 's');
     REQUIRE_THROWS(tree[1]);
 }
+
+TEST_CASE("Binary Tree Order Statistic")
+{
+    auto tree = BinaryTree<U, U>();
+    for (U i = 1; i < 100; i++)
+        tree.set(i * 2, i);
+
+    REQUIRE(tree.get_count() == 100);
+    REQUIRE(tree.get_height() == 100);
+
+    tree.balance();
+
+    REQUIRE(tree.get_count() == 100);
+    REQUIRE(tree.get_height() < 100);
+    REQUIRE(tree[198] == 99);
+    REQUIRE(tree.rank(0) == 0);
+    REQUIRE(tree.rank(7) == 4);
+    REQUIRE(tree.rank(8) == 4);
+    REQUIRE(tree.rank(1000) == 100);
+    REQUIRE(tree.select(0).first == 0);
+    REQUIRE(tree.select(4).first == 8);
+    REQUIRE(tree.select(99).second == 99);
+    REQUIRE_THROWS(tree.select(100));
+    REQUIRE(tree.percentile(0.5).first == 98);
+    REQUIRE(tree.percentile(1).first == 198);
+    REQUIRE_THROWS(tree.percentile(1.5));
+}
+
+TEST_CASE("Binary Tree Batched Lookup")
+{
+    auto tree = BinaryTree<U, U>();
+    for (U i = 1; i < 50; i++)
+        tree.set((i * 37) % 101, i);
+    tree.balance();
+
+    U keys[100];
+    for (U i = 0; i < 100; i++)
+        keys[i] = i;
+
+    auto results = List<U *>();
+    tree.find_many(ListView(keys, 100), results);
+    REQUIRE(results.get_count() == 100);
+    for (U i = 0; i < 100; i++)
+    {
+        REQUIRE(results[i] == tree.find(i));
+        if (results[i] != nullptr)
+            REQUIRE(*results[i] == tree[i]);
+    }
+    REQUIRE(*results[37] == 1);
+    REQUIRE(results[1] == nullptr);
+}
+
+TEST_CASE("Binary Tree Copy")
+{
+    auto tree = BinaryTree<U, C>();
+    tree.set(1, 'a');
+    tree.set(2, 'b');
+
+    auto copied = tree;
+    copied.set(2, 'B');
+
+    REQUIRE(copied.get_count() == 3);
+    REQUIRE(copied[2] == 'B');
+    REQUIRE(tree[2] == 'b');
+}
+
+TEST_CASE("Binary Tree Iteration")
+{
+    auto chain = BinaryTree<U, U>();
+    for (U i = 1; i < 500; i++)
+        chain.set(i, i * 2);
+    REQUIRE(chain.get_height() > BinaryTree<U, U>::FOR_EACH_STACK_CAPACITY);
+
+    U expected = 0;
+    chain.for_each([&](const U &p_key, const U &p_value)
+                   {
+                       REQUIRE(p_key == expected);
+                       REQUIRE(p_value == expected * 2);
+                       expected++; });
+    REQUIRE(expected == 500);
+
+    chain.balance();
+    expected = 0;
+    chain.for_each([&](const U &p_key, const U &)
+                   { REQUIRE(p_key == expected++); });
+    REQUIRE(expected == 500);
+}
+
+TEST_CASE("Binary Tree Merge")
+{
+    auto tree = BinaryTree<U, U>();
+    for (U i = 1; i < 10; i++)
+        tree.set(i * 2, i);
+
+    U keys[] = {3, 4, 5, 30};
+    U values[] = {30, 40, 50, 300};
+    auto incoming = BinaryTree<U, U>::from_sorted(ListView(keys, 4), ListView(values, 4));
+    REQUIRE(incoming->get_count() == 4);
+
+    tree.merge(move(incoming), [](const U &, const U &p_current, const U &p_incoming) -> U
+               { return p_current + p_incoming; });
+
+    REQUIRE(tree.get_count() == 13);
+    REQUIRE(tree.get_height() == 4);
+    REQUIRE(tree[3] == 30);
+    REQUIRE(tree[4] == 42);
+    REQUIRE(tree[18] == 9);
+    REQUIRE(tree[30] == 300);
+    REQUIRE(tree.rank(30) == 12);
+
+    U unsorted[] = {2, 1};
+    REQUIRE_THROWS(BinaryTree<U, U>::from_sorted(ListView(unsorted, 2), ListView(values, 2)));
+
+    // A throwing resolver leaves this tree untouched and frees the incoming one.
+    U overlapping[] = {1, 4, 31};
+    auto rejected = BinaryTree<U, U>::from_sorted(ListView(overlapping, 3), ListView(values, 3));
+    REQUIRE_THROWS(tree.merge(move(rejected), [](const U &, const U &, const U &) -> U
+                              { throw Exception<LOGICAL>("Conflicting key."); }));
+    REQUIRE(tree.get_count() == 13);
+    REQUIRE(tree[4] == 42);
+    REQUIRE_FALSE(tree.contains(1));
+    REQUIRE(tree.rank(30) == 12);
+}
+
+TEST_CASE("Binary Tree Equal Key Subtree")
+{
+    auto tree = BinaryTree<U, C>();
+    tree.set(5, 'a');
+    tree.set(2, 'b');
+
+    U keys[] = {1, 2, 3};
+    C values[] = {'x', 'y', 'z'};
+    tree.set(BinaryTree<U, C>::from_sorted(ListView(keys, 3), ListView(values, 3)));
+
+    REQUIRE(tree.get_count() == 5);
+    REQUIRE(tree[0] == '\0');
+    REQUIRE(tree[1] == 'x');
+    REQUIRE(tree[2] == 'y');
+    REQUIRE(tree[3] == 'z');
+    REQUIRE(tree[5] == 'a');
+}
+
+TEST_CASE("Binary Tree Set Operations")
+{
+    auto left = BinaryTree<U, U>();
+    auto right = BinaryTree<U, U>();
+    for (U i = 1; i < 10; i++)
+    {
+        left.set(i, i);
+        right.set(i * 2, i * 2);
+    }
+    const auto sum = [](const U &, const U &p_left, const U &p_right) -> U
+    { return p_left + p_right; };
+
+    auto united = binary_tree_union(left, right, sum);
+    REQUIRE(united->get_count() == 15);
+    REQUIRE((**united)[4] == 8);
+    REQUIRE((**united)[9] == 9);
+    REQUIRE((**united)[18] == 18);
+
+    auto intersected = binary_tree_intersection(left, right, sum);
+    REQUIRE(intersected->get_count() == 5);
+    REQUIRE((**intersected)[8] == 16);
+    REQUIRE_FALSE(intersected->contains(3));
+
+    auto subtracted = binary_tree_difference(left, right);
+    REQUIRE(subtracted->get_count() == 5);
+    REQUIRE(subtracted->contains(9));
+    REQUIRE_FALSE(subtracted->contains(0));
+
+    auto empty = binary_tree_difference(left, left);
+    REQUIRE_FALSE(empty);
+}
+
+template <class T>
+struct CountingAllocator : Inconstructible
+{
+    static inline I64 balance = 0;
+    static auto allocate(Size p_count = 1) -> T *
+    {
+        balance++;
+        return Allocator<T>::allocate(p_count);
+    }
+    static auto deallocate(T *p_pointer) -> void
+    {
+        balance--;
+        Allocator<T>::deallocate(p_pointer);
+    }
+};
+
+TEST_CASE("Binary Tree Teardown")
+{
+    using Tree = BinaryTree<U, U, CountingAllocator>;
+    {
+        auto tree = Tree();
+        for (U i = 1; i < 10000; i++)
+            tree.set(i, i);
+        REQUIRE(tree.get_height() == 10000);
+        REQUIRE(CountingAllocator<Tree>::balance == 9999);
+    }
+    REQUIRE(CountingAllocator<Tree>::balance == 0);
+
+    using ArenaTree = BinaryTree<U, U, ArenaAllocator>;
+    {
+        auto tree = ArenaTree();
+        for (U i = 1; i < 1000; i++)
+            tree.set(i, i);
+        REQUIRE(tree[999] == 999);
+
+        // Each tree owns its arena, so dropping one leaves the other intact.
+        {
+            auto other = ArenaTree();
+            for (U i = 1; i < 1000; i++)
+                other.set(i, i * 2);
+            auto copied = other;
+            REQUIRE(copied[500] == 1000);
+        }
+        REQUIRE(tree[500] == 500);
+    }
+
+    auto keys = List<U>(4096);
+    auto values = List<U>(4096);
+    for (U i = 0; i < 4096; i++)
+    {
+        keys.append(i);
+        values.append(i);
+    }
+    auto index = ArenaTree::from_sorted(keys, values);
+    for (U swap = 1; swap < 64; swap++)
+    {
+        values[0] = swap;
+        index = ArenaTree::from_sorted(keys, values);
+        REQUIRE((**index)[0] == swap);
+    }
+
+    auto incoming = ArenaTree::from_sorted(keys, values);
+    index->merge(move(incoming));
+    index->set(ArenaTree::from_sorted(ListView<U>(keys.view_data(), 1), ListView<U>(values.view_data(), 1)));
+    REQUIRE(index->get_count() == 4096);
+}
\ No newline at end of file
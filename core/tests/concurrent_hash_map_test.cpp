@@ -0,0 +1,80 @@
+#include <catch2/catch_test_macros.hpp>
+#include <concurrent_hash_map.hpp>
+
+using namespace Rong;
+
+TEST_CASE("Concurrent hash map base feature")
+{
+    auto map = ConcurrentHashMap<U, U>();
+    for (U i = 0; i < 1000; i++)
+        map.set(i, i * 2);
+
+    REQUIRE(map.get_count() == 1000);
+    REQUIRE(map[10] == 20);
+    REQUIRE(map.contains(999));
+    REQUIRE_FALSE(map.contains(1000));
+    REQUIRE_THROWS(map[1000]);
+
+    U value = 0;
+    REQUIRE(map.find(3, value));
+    REQUIRE(value == 6);
+    REQUIRE_FALSE(map.find(1000, value));
+
+    REQUIRE(map.remove(3) == 6);
+    REQUIRE(map.get_count() == 999);
+
+    Size visited = 0;
+    map.for_each([&](const U &p_key, const U &p_value)
+                 { visited += p_key * 2 == p_value; });
+    REQUIRE(visited == 999);
+
+    map.clean();
+    REQUIRE(map.get_count() == 0);
+}
+
+struct Worker
+{
+    ConcurrentHashMap<U, U> *map;
+    U id;
+};
+
+static auto work(void *p_worker) -> void *
+{
+    auto worker = static_cast<Worker *>(p_worker);
+    for (U i = 0; i < 2000; i++)
+    {
+        worker->map->set(worker->id * 2000 + i, i);
+        worker->map->update(0xFFFFFFFF, 0, [](U &p_value)
+                            { p_value++; });
+        U value = 0;
+        if (worker->map->find(worker->id * 2000 + i / 2, value) && value != i / 2)
+            return p_worker;
+    }
+    return nullptr;
+}
+
+TEST_CASE("Concurrent hash map shared between threads")
+{
+    constexpr const U THREAD_COUNT = 8;
+    auto map = ConcurrentHashMap<U, U>();
+    pthread_t threads[THREAD_COUNT];
+    Worker workers[THREAD_COUNT];
+    for (U i = 0; i < THREAD_COUNT; i++)
+    {
+        workers[i] = {&map, i};
+        REQUIRE(pthread_create(threads + i, nullptr, work, workers + i) == 0);
+    }
+
+    Size failed = 0;
+    for (U i = 0; i < THREAD_COUNT; i++)
+    {
+        void *result = nullptr;
+        pthread_join(threads[i], &result);
+        failed += result != nullptr;
+    }
+
+    REQUIRE(failed == 0);
+    REQUIRE(map.get_count() == THREAD_COUNT * 2000 + 1);
+    REQUIRE(map[0xFFFFFFFF] == THREAD_COUNT * 2000);
+    REQUIRE(map[5 * 2000 + 17] == 17);
+}
\ No newline at end of file
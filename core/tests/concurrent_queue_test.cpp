@@ -0,0 +1,115 @@
+#include <catch2/catch_test_macros.hpp>
+#include <pthread.h>
+#include <sched.h>
+#include <concurrent_queue.hpp>
+
+using namespace Rong;
+
+TEST_CASE("Concurrent queue base feature")
+{
+    REQUIRE_THROWS(ConcurrentQueue<U>(6));
+
+    auto queue = ConcurrentQueue<U>(4);
+    U value = 0;
+    REQUIRE_FALSE(queue.dequeue(value));
+    for (U i = 0; i < 4; i++)
+        REQUIRE(queue.enqueue(i));
+    REQUIRE_FALSE(queue.enqueue(4));
+    REQUIRE(queue.get_count() == 4);
+
+    REQUIRE(queue.dequeue(value));
+    REQUIRE(value == 0);
+    REQUIRE(queue.enqueue(4));
+    for (U i = 1; i < 5; i++)
+    {
+        REQUIRE(queue.dequeue(value));
+        REQUIRE(value == i);
+    }
+    REQUIRE_FALSE(queue.dequeue(value));
+}
+
+TEST_CASE("Concurrent queue batches")
+{
+    auto queue = ConcurrentQueue<List<C>>(8);
+    auto words = List<List<C>>();
+    for (U i = 0; i < 10; i++)
+        words.append(List<C>("word", 1 + i % 4));
+
+    REQUIRE(queue.enqueue_many(ListView<List<C>>(words.view_data(), words.get_count())) == 8);
+    REQUIRE(queue.enqueue_many(ListView<List<C>>(words.view_data(), words.get_count())) == 0);
+
+    auto taken = List<List<C>>();
+    REQUIRE(queue.dequeue_many(taken, 3) == 3);
+    REQUIRE(queue.enqueue_many(ListView<List<C>>(words.view_data() + 8, 2)) == 2);
+    REQUIRE(queue.dequeue_many(taken, 100) == 7);
+    REQUIRE(taken.get_count() == 10);
+    for (U i = 0; i < 10; i++)
+        REQUIRE(taken[i].get_count() == 1 + i % 4);
+
+    // Elements still queued are destroyed with the queue.
+    REQUIRE(queue.enqueue_many(ListView<List<C>>(words.view_data(), 5)) == 5);
+}
+
+struct Endpoint
+{
+    ConcurrentQueue<U> *queue;
+    U first;
+    U count;
+    U64 sum;
+};
+
+static auto produce(void *p_endpoint) -> void *
+{
+    auto endpoint = static_cast<Endpoint *>(p_endpoint);
+    for (U i = 0; i < endpoint->count; i++)
+        while (!endpoint->queue->enqueue(endpoint->first + i))
+            sched_yield();
+    return nullptr;
+}
+
+static auto consume(void *p_endpoint) -> void *
+{
+    auto endpoint = static_cast<Endpoint *>(p_endpoint);
+    auto taken = List<U>();
+    while (endpoint->count != 0)
+    {
+        taken.clean();
+        const auto count = endpoint->queue->dequeue_many(taken, endpoint->count < 16 ? endpoint->count : 16);
+        for (U i = 0; i < count; i++)
+            endpoint->sum += taken[i];
+        endpoint->count -= count;
+        if (count == 0)
+            sched_yield();
+    }
+    return nullptr;
+}
+
+TEST_CASE("Concurrent queue between threads")
+{
+    constexpr const U THREAD_COUNT = 4;
+    constexpr const U ELEMENT_COUNT = 20000;
+    auto queue = ConcurrentQueue<U>(64);
+    pthread_t producers[THREAD_COUNT];
+    pthread_t consumers[THREAD_COUNT];
+    Endpoint producer_endpoints[THREAD_COUNT];
+    Endpoint consumer_endpoints[THREAD_COUNT];
+    for (U i = 0; i < THREAD_COUNT; i++)
+    {
+        producer_endpoints[i] = {&queue, i * ELEMENT_COUNT, ELEMENT_COUNT, 0};
+        consumer_endpoints[i] = {&queue, 0, ELEMENT_COUNT, 0};
+        pthread_create(producers + i, nullptr, produce, producer_endpoints + i);
+        pthread_create(consumers + i, nullptr, consume, consumer_endpoints + i);
+    }
+
+    U64 sum = 0;
+    for (U i = 0; i < THREAD_COUNT; i++)
+    {
+        pthread_join(producers[i], nullptr);
+        pthread_join(consumers[i], nullptr);
+        sum += consumer_endpoints[i].sum;
+    }
+
+    const U64 total = THREAD_COUNT * ELEMENT_COUNT;
+    REQUIRE(sum == total * (total - 1) / 2);
+    REQUIRE(queue.get_count() == 0);
+}
\ No newline at end of file
@@ -0,0 +1,49 @@
+#include <catch2/catch_test_macros.hpp>
+#include <binary_tree.hpp>
+
+using namespace Rong;
+
+TEST_CASE("Frozen binary tree from binary tree")
+{
+    auto tree = BinaryTree<U, C>();
+    tree.set(0, 'H');
+    tree.set(8, '6');
+    tree.set(2, 'E');
+    tree.set(13, 'a');
+    tree.set(3, 'P');
+    tree.set(11, '9');
+
+    const auto frozen = tree.freeze();
+    REQUIRE(frozen.get_count() == 6);
+    REQUIRE(frozen[0] == 'H');
+    REQUIRE(frozen[2] == 'E');
+    REQUIRE(frozen[3] == 'P');
+    REQUIRE(frozen[8] == '6');
+    REQUIRE(frozen[11] == '9');
+    REQUIRE(frozen[13] == 'a');
+    REQUIRE(frozen.find(1) == nullptr);
+    REQUIRE_FALSE(frozen.contains(14));
+    REQUIRE_THROWS(frozen[12]);
+}
+
+TEST_CASE("Frozen binary tree from sorted list")
+{
+    constexpr U keys[] = {1, 3, 5, 7, 9, 11, 13, 15, 17, 19};
+    constexpr auto values = "abcdefghij";
+    const auto frozen = FrozenBinaryTree<U, C>(ListView(keys, 10), ListView(values, 10));
+
+    for (Size i = 0; i < 10; i++)
+    {
+        REQUIRE(frozen[keys[i]] == values[i]);
+        REQUIRE_FALSE(frozen.contains(keys[i] + 1));
+    }
+    REQUIRE_FALSE(frozen.contains(0));
+
+    Size visited = 0;
+    frozen.for_each([&](const U &p_key, const C &)
+                    { REQUIRE(p_key == keys[visited++]); });
+    REQUIRE(visited == 10);
+
+    constexpr U unsorted[] = {3, 1};
+    REQUIRE_THROWS(FrozenBinaryTree<U, C>(ListView(unsorted, 2), ListView(values, 2)));
+}
\ No newline at end of file
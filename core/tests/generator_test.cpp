@@ -0,0 +1,62 @@
+#include <catch2/catch_test_macros.hpp>
+#include <generator.hpp>
+#include <iterator.hpp>
+#include <list.hpp>
+
+using namespace Rong;
+
+static auto count_up(U p_begin, U p_end) -> Generator<U>
+{
+    for (auto i = p_begin; i < p_end; i++)
+        co_yield i;
+}
+
+static auto squares(Generator<U> p_source) -> Generator<U>
+{
+    for (auto it = p_source.cbegin(); it != p_source.cend(); ++it)
+        co_yield *it * *it;
+}
+
+TEST_CASE("Generator base feature")
+{
+    auto generator = count_up(3, 8);
+    U expected = 3;
+    for (auto it = generator.cbegin(); it != generator.cend(); ++it)
+        REQUIRE(*it == expected++);
+    REQUIRE(expected == 8);
+    REQUIRE_THROWS(generator.cbegin());
+
+    auto empty = count_up(5, 5);
+    REQUIRE(empty.cbegin() == empty.cend());
+}
+
+TEST_CASE("Generator composition")
+{
+    auto list = List<U>(squares(count_up(0, 5)).cbegin(), Generator<U>::Iterator(nullptr));
+    REQUIRE(list.get_count() == 5);
+    REQUIRE(list[4] == 16);
+
+    auto generator = count_up(10, 13);
+    U sum = 0;
+    generator.for_each([&](Size p_index, const U &p_value)
+                       { sum += p_index * p_value; });
+    REQUIRE(sum == 0 * 10 + 1 * 11 + 2 * 12);
+
+    auto left = count_up(0, 100);
+    auto right = squares(count_up(0, 3));
+    Size visited = 0;
+    auto zipped = zip(left, right);
+    for (auto it = zipped.cbegin(); it != zipped.cend(); ++it)
+    {
+        auto [first, second] = *it;
+        REQUIRE(first * first == second);
+        visited++;
+    }
+    REQUIRE(visited == 3);
+
+    auto numbered = count_up(7, 9);
+    auto enumerated = enumerate(numbered.cbegin(), numbered.cend());
+    auto it = enumerated.cbegin();
+    REQUIRE((*it).first == 0);
+    REQUIRE((*it).second == 7);
+}
\ No newline at end of file
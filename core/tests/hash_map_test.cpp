@@ -0,0 +1,97 @@
+#include <catch2/catch_test_macros.hpp>
+#include <hash_map.hpp>
+#include <list.hpp>
+#include <tuple.hpp>
+
+using namespace Rong;
+
+TEST_CASE("Hash map base feature")
+{
+    auto map = HashMap<U, U>();
+    for (U i = 0; i < 1000; i++)
+        map.set(i, i * 3);
+
+    REQUIRE(map.get_count() == 1000);
+    REQUIRE(map[0] == 0);
+    REQUIRE(map[999] == 2997);
+    REQUIRE(map.find(1000) == nullptr);
+    REQUIRE_THROWS(map[1000]);
+
+    map.set(7, 8);
+    REQUIRE(map[7] == 8);
+    REQUIRE(map.get_count() == 1000);
+}
+
+TEST_CASE("Hash map removal")
+{
+    auto map = HashMap<U, C>();
+    map.set(1, 'a');
+    map.set(2, 'b');
+
+    REQUIRE(map.remove(1) == 'a');
+    REQUIRE_FALSE(map.contains(1));
+    REQUIRE(map.get_count() == 1);
+    REQUIRE_THROWS(map.remove(1));
+
+    for (U round = 0; round < 100; round++)
+    {
+        for (U i = 0; i < 50; i++)
+            map.set(1000 + round * 100 + i, 'x');
+        for (U i = 0; i < 50; i++)
+            map.remove(1000 + round * 100 + i);
+    }
+    REQUIRE(map.get_count() == 1);
+    REQUIRE(map[2] == 'b');
+    REQUIRE(map.get_capacity() <= 128);
+}
+
+TEST_CASE("Hash map iteration and reserve")
+{
+    auto map = HashMap<U, U>();
+    map.reserve(100);
+    const auto capacity = map.get_capacity();
+    for (U i = 0; i < 100; i++)
+        map.set(i, i);
+    REQUIRE(map.get_capacity() == capacity);
+
+    U sum = 0;
+    for (auto it = map.cbegin(); it != map.cend(); ++it)
+    {
+        auto [key, value] = *it;
+        REQUIRE(key == value);
+        sum += key;
+    }
+    REQUIRE(sum == 4950);
+
+    const auto copied = map;
+    Size visited = 0;
+    copied.for_each([&](const U &, const U &)
+                    { visited++; });
+    REQUIRE(visited == 100);
+}
+
+TEST_CASE("Hash map with composite keys")
+{
+    auto words = HashMap<List<C>, U>();
+    const C *names[] = {"alpha", "beta", "gamma", "a much longer name that spans several hash rounds"};
+    for (U i = 0; i < 4; i++)
+        words.set(List<C>(names[i], strlen(names[i])), i);
+    for (U i = 0; i < 200; i++)
+    {
+        auto key = List<C>();
+        for (U j = 0; j <= i % 20; j++)
+            key.append('a' + (i + j) % 26);
+        key.append('0' + i / 20);
+        words.set(key, i + 10);
+    }
+    REQUIRE(words[List<C>("gamma", 5)] == 2);
+    REQUIRE(words[List<C>(names[3], strlen(names[3]))] == 3);
+    REQUIRE_FALSE(words.contains(List<C>("delta", 5)));
+
+    auto grid = HashMap<Tuple<U, U>, U>();
+    for (U x = 0; x < 32; x++)
+        for (U y = 0; y < 32; y++)
+            grid.set(Tuple<U, U>(x, y), x * 32 + y);
+    REQUIRE(grid.get_count() == 1024);
+    REQUIRE(grid[Tuple<U, U>(3, 5)] == 101);
+}
\ No newline at end of file
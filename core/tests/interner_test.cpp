@@ -0,0 +1,105 @@
+#include <catch2/catch_test_macros.hpp>
+#include <pthread.h>
+#include <stdio.h>
+#include <interner.hpp>
+
+using namespace Rong;
+
+TEST_CASE("Interner base feature")
+{
+    auto interner = StringInterner<>();
+    const auto apple = interner.intern("apple");
+    const auto banana = interner.intern(String("banana"));
+    const auto empty = interner.intern("");
+
+    auto buffer = List<C>("xxapplexx", 9);
+    REQUIRE(interner.intern(buffer.slice(2, 7)) == apple);
+    REQUIRE_FALSE(apple == banana);
+    REQUIRE(contrast(apple, apple) == 0);
+    REQUIRE(contrast(apple, banana) != 0);
+    REQUIRE(hash(apple) == hash(interner.intern("apple")));
+    REQUIRE(interner.get_count() == 3);
+
+    REQUIRE(interner.view(apple) == "apple");
+    REQUIRE(interner.view(banana) == "banana");
+    REQUIRE(interner.view(empty).get_count() == 0);
+    // The stored copy does not alias the caller's buffer.
+    REQUIRE(interner.view(apple).view_data() != buffer.view_data() + 2);
+
+    auto found = Symbol{0};
+    REQUIRE(interner.find(ListView<C>(buffer.view_data() + 2, 5), found));
+    REQUIRE(found == apple);
+    REQUIRE_FALSE(interner.find("cherry", found));
+    REQUIRE(interner.get_count() == 3);
+    REQUIRE_THROWS(interner.view(Symbol{0xFFFFFFF0}));
+
+    // Strings larger than a chunk get their own block.
+    auto large = String();
+    for (Size i = 0; i < StringInterner<>::CHUNK_SIZE + 10; i++)
+        large.append('a' + i % 26);
+    const auto large_symbol = interner.intern(large);
+    REQUIRE(interner.view(large_symbol) == large);
+    REQUIRE(interner.view(apple) == "apple");
+}
+
+TEST_CASE("Interner handles many strings")
+{
+    auto interner = StringInterner<>();
+    auto symbols = List<Symbol>();
+    for (U i = 0; i < 20000; i++)
+    {
+        C text[16];
+        const auto count = snprintf(text, sizeof(text), "id-%u", i);
+        symbols.append(interner.intern(StringView(text, count)));
+    }
+    REQUIRE(interner.get_count() == 20000);
+    for (U i = 0; i < 20000; i += 997)
+    {
+        C text[16];
+        const auto count = snprintf(text, sizeof(text), "id-%u", i);
+        REQUIRE(interner.view(symbols[i]) == StringView(text, count));
+        REQUIRE(interner.intern(StringView(text, count)) == symbols[i]);
+    }
+}
+
+struct InternWork
+{
+    StringInterner<> *interner;
+    U offset;
+    Symbol symbols[1000];
+};
+
+static auto intern_vocabulary(void *p_work) -> void *
+{
+    auto work = static_cast<InternWork *>(p_work);
+    for (U j = 0; j < 1000; j++)
+    {
+        const auto i = (j + work->offset) % 1000;
+        C text[16];
+        const auto count = snprintf(text, sizeof(text), "word-%u", i);
+        work->symbols[i] = work->interner->intern(StringView(text, count));
+    }
+    return nullptr;
+}
+
+TEST_CASE("Interner is thread-safe")
+{
+    auto interner = StringInterner<>();
+    InternWork works[4];
+    pthread_t threads[4];
+    for (U t = 0; t < 4; t++)
+    {
+        works[t].interner = &interner;
+        works[t].offset = t * 250;
+        REQUIRE(pthread_create(&threads[t], nullptr, intern_vocabulary, &works[t]) == 0);
+    }
+    for (U t = 0; t < 4; t++)
+        pthread_join(threads[t], nullptr);
+
+    REQUIRE(interner.get_count() == 1000);
+    B consistent = true;
+    for (U i = 0; i < 1000; i++)
+        for (U t = 1; t < 4; t++)
+            consistent = consistent && works[t].symbols[i] == works[0].symbols[i];
+    REQUIRE(consistent);
+}
\ No newline at end of file
@@ -21,4 +21,110 @@ TEST_CASE("Reverse Iterator")
     ++iterator;
     REQUIRE(*iterator == '1');
     ++iterator;
+}
+
+TEST_CASE("Multi Zip Iterator")
+{
+    auto first = List<I32>();
+    auto second = List<F64>();
+    auto third = List<C>();
+    for (I32 i = 0; i < 4; i++)
+    {
+        first.append(i);
+        second.append(i * 0.5);
+        third.append('a' + i);
+    }
+    third.append('z');
+
+    auto iterable = zip(first, second, third);
+    Size count = 0;
+    for (auto iterator = iterable.cbegin(); !(iterator == iterable.cend()); ++iterator, count++)
+    {
+        const auto [number, half, letter] = *iterator;
+        REQUIRE(&number == &first[count]);
+        REQUIRE(half == number * 0.5);
+        REQUIRE(letter == 'a' + number);
+    }
+    REQUIRE(count == 4);
+
+    for (auto [number, half, letter] : accessible_zip(first, second, third))
+    {
+        half += number;
+        letter = 'A' + number;
+    }
+    REQUIRE(second[3] == 4.5);
+    REQUIRE(third[2] == 'C');
+    REQUIRE(third[4] == 'z');
+}
+
+TEST_CASE("Pair forwarding")
+{
+    auto value = 1;
+    auto pair = Pair<I32 &, F64>(value, 2);
+    pair.first = 3;
+    REQUIRE(value == 3);
+    REQUIRE(Pair(1, 'a').second == 'a');
+}
+
+/// Sums by halving the range until the pieces are small, as a parallel reduction would partition it.
+template <class T>
+static auto split_sum(const T &p_range) -> I64
+{
+    if (p_range.get_count() <= 3)
+    {
+        I64 sum = 0;
+        for (auto it = p_range.cbegin(); !(it == p_range.cend()); ++it)
+        {
+            const auto [first, second] = *it;
+            sum += first * second;
+        }
+        return sum;
+    }
+    const auto halves = p_range.split_at(p_range.get_count() / 2);
+    return split_sum(halves.first) + split_sum(halves.second);
+}
+
+TEST_CASE("Splittable ranges")
+{
+    auto numbers = List<I32>();
+    for (I32 i = 0; i < 10; i++)
+        numbers.append(i);
+    auto longer = numbers;
+    longer.append(100);
+
+    auto plain = IteratorWrapper(numbers.cbegin(), numbers.cend());
+    STATIC_REQUIRE(IsSplittableRange<decltype(plain)>);
+    REQUIRE(plain.get_count() == 10);
+    const auto halves = plain.split_at(4);
+    REQUIRE(halves.first.get_count() == 4);
+    REQUIRE(*halves.second.cbegin() == 4);
+    REQUIRE_THROWS(plain.split_at(11));
+
+    auto pairs = zip(numbers, longer);
+    STATIC_REQUIRE(IsSplittableRange<decltype(pairs)>);
+    REQUIRE(pairs.get_count() == 10);
+    REQUIRE(split_sum(pairs) == 285);
+
+    const auto indexed = enumerate(numbers.cbegin(), numbers.cend());
+    REQUIRE(split_sum(indexed) == 285);
+    const auto tail = indexed.split_at(7).second;
+    REQUIRE((*tail.cbegin()).first == 7);
+
+    const auto backwards = reverse(numbers.cbegin(), numbers.cend());
+    REQUIRE(backwards.get_count() == 10);
+    auto it = backwards.cbegin();
+    it += 3;
+    REQUIRE(*it == 6);
+    REQUIRE(*backwards.split_at(9).second.cbegin() == 0);
+
+    const auto triples = zip(numbers, longer, numbers);
+    REQUIRE(triples.get_count() == 10);
+    auto row = triples.cbegin();
+    row += 5;
+    REQUIRE((*row).get<2>() == 5);
+
+    for (auto [number, square] : accessible_zip(numbers, longer).split_at(5).second)
+        square = number * number;
+    REQUIRE(longer[9] == 81);
+    REQUIRE(longer[4] == 4);
 }
\ No newline at end of file
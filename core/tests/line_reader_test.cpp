@@ -0,0 +1,94 @@
+#include <catch2/catch_test_macros.hpp>
+#include <stdlib.h>
+#include <line_reader.hpp>
+
+using namespace Rong;
+
+static auto make_record(Size p_index) -> List<C>
+{
+    auto record = List<C>();
+    for (Size i = 0; i < p_index % 23; i++)
+        record.append('a' + (p_index + i) % 26);
+    return record;
+}
+
+TEST_CASE("Line reader splits across chunk boundaries")
+{
+    auto content = List<C>();
+    for (Size i = 0; i < 5000; i++)
+    {
+        auto record = make_record(i);
+        for (Size j = 0; j < record.get_count(); j++)
+            content.append(record[j]);
+        content.append('\n');
+    }
+
+    C path[] = "/tmp/rong_line_reader_XXXXXX";
+    const auto descriptor = mkstemp(path);
+    REQUIRE(descriptor >= 0);
+    REQUIRE(write(descriptor, content.view_data(), content.get_count()) == static_cast<I64>(content.get_count()));
+    close(descriptor);
+
+    // Chunks shorter than some records force carrying across several chunks.
+    const Size chunk_sizes[] = {7, 64, LineReader::DEFAULT_CHUNK_SIZE};
+    for (auto chunk_size : chunk_sizes)
+    {
+        auto reader = LineReader(path, chunk_size);
+        Size count = 0;
+        B matched = true;
+        reader.for_each([&](Size p_index, const ListView<C> &p_record)
+                        {
+                            matched = matched && p_record == make_record(p_index);
+                            count++; });
+        REQUIRE(matched);
+        REQUIRE(count == 5000);
+
+        auto record = ListView<C>();
+        REQUIRE_FALSE(reader.next(record));
+    }
+    unlink(path);
+}
+
+TEST_CASE("Line reader over a pipe")
+{
+    I pipe_descriptors[2];
+    REQUIRE(pipe(pipe_descriptors) == 0);
+    const C content[] = "first\n\nthird,with,delimiter\nlast";
+    REQUIRE(write(pipe_descriptors[1], content, sizeof(content) - 1) == sizeof(content) - 1);
+    close(pipe_descriptors[1]);
+
+    {
+        auto reader = LineReader(pipe_descriptors[0], 4);
+        auto record = ListView<C>();
+        REQUIRE(reader.next(record));
+        REQUIRE(record == ListView<C>("first", 5));
+        REQUIRE(reader.next(record));
+        REQUIRE(record.get_count() == 0);
+        REQUIRE(reader.next(record));
+        REQUIRE(record == ListView<C>("third,with,delimiter", 20));
+        REQUIRE(reader.next(record));
+        REQUIRE(record == ListView<C>("last", 4));
+        REQUIRE_FALSE(reader.next(record));
+    }
+    close(pipe_descriptors[0]);
+}
+
+TEST_CASE("Line reader with custom delimiter and early destruction")
+{
+    I pipe_descriptors[2];
+    REQUIRE(pipe(pipe_descriptors) == 0);
+    const C content[] = "a,b,,c";
+    REQUIRE(write(pipe_descriptors[1], content, sizeof(content) - 1) == sizeof(content) - 1);
+    close(pipe_descriptors[1]);
+
+    {
+        auto reader = LineReader(pipe_descriptors[0], 2, ',');
+        auto record = ListView<C>();
+        REQUIRE(reader.next(record));
+        REQUIRE(record == ListView<C>("a", 1));
+    }
+    close(pipe_descriptors[0]);
+
+    REQUIRE_THROWS(LineReader("/tmp/rong_line_reader_missing"));
+    REQUIRE_THROWS(LineReader(0, 0));
+}
\ No newline at end of file
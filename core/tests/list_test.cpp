@@ -105,4 +105,78 @@ TEST_CASE("List Removal")
     list.remove(2);
 
     REQUIRE(list == view);
+}
+
+TEST_CASE("List Append")
+{
+    auto list = List<U>();
+    for (U i = 0; i < 100; i++)
+        list.append(i);
+
+    REQUIRE(list.get_count() == 100);
+    REQUIRE(list.get_capacity() == 128);
+    for (U i = 0; i < 100; i++)
+        REQUIRE(list[i] == i);
+}
+
+TEST_CASE("List resize")
+{
+    auto list = List<U>();
+    list.resize(40);
+    REQUIRE(list.get_count() == 40);
+    REQUIRE(list[39] == 0);
+    list.access_data()[5] = 9;
+    list.resize(6);
+    REQUIRE(list.get_count() == 6);
+    REQUIRE(list[5] == 9);
+}
+
+TEST_CASE("List algorithms")
+{
+    const U values[] = {1, 2, 3, 4};
+    const auto view = ListView<U>(values, 4);
+    auto doubled = view.map<U>([](Size, const U &p_value)
+                               { return p_value * 2; });
+    REQUIRE(doubled[3] == 8);
+    auto even = view.filter([](Size, const U &p_value)
+                            { return p_value % 2 == 0; });
+    REQUIRE(even.get_count() == 2);
+    REQUIRE(even[1] == 4);
+
+    const auto copied = List<U>(view.cbegin(), view.cend());
+    REQUIRE(copied == view);
+}
+
+TEST_CASE("List hash")
+{
+    const C text[] = "the quick brown fox jumps over the lazy dog, twice over the lazy dog";
+    const auto length = sizeof(text) - 1;
+    for (Size i = 0; i <= length; i++)
+        for (Size j = 0; j < i; j++)
+            REQUIRE(hash_bytes(text, i) != hash_bytes(text, j));
+    REQUIRE(hash_bytes(text, length, 1) != hash_bytes(text, length, 2));
+
+    const auto list = List<C>(text, length);
+    REQUIRE(hash(list) == hash(ListView<C>(text, length)));
+    REQUIRE(hash(list) != hash(ListView<C>(text, length - 1)));
+}
+
+TEST_CASE("List assignment")
+{
+    auto list = List<U>();
+    for (U i = 0; i < 10; i++)
+        list.append(i);
+
+    auto copied = List<U>();
+    copied.append(42);
+    copied = list;
+    REQUIRE(copied == list);
+    copied[0] = 7;
+    REQUIRE(list[0] == 0);
+
+    auto moved = List<U>();
+    moved = move(copied);
+    REQUIRE(moved.get_count() == 10);
+    REQUIRE(moved[0] == 7);
+    REQUIRE(copied.get_count() == 0);
 }
\ No newline at end of file
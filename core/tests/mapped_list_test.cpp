@@ -0,0 +1,75 @@
+#include <catch2/catch_test_macros.hpp>
+#include <stdlib.h>
+#include <mapped_list.hpp>
+
+using namespace Rong;
+
+static auto write_temporary(C *p_path, const void *p_data, Size p_size) -> void
+{
+    const auto descriptor = mkstemp(p_path);
+    REQUIRE(descriptor >= 0);
+    REQUIRE(write(descriptor, p_data, p_size) == static_cast<I64>(p_size));
+    close(descriptor);
+}
+
+TEST_CASE("Mapped list base feature")
+{
+    U values[1000];
+    for (U i = 0; i < 1000; i++)
+        values[i] = i * 3;
+    C path[] = "/tmp/rong_mapped_XXXXXX";
+    write_temporary(path, values, sizeof(values));
+
+    auto list = MappedList<U>(path);
+    list.advise(ADVICE_SEQUENTIAL);
+    list.advise(ADVICE_RANDOM);
+    REQUIRE(list.get_count() == 1000);
+    REQUIRE(list[999] == 2997);
+    REQUIRE_THROWS(list[1000]);
+    REQUIRE(list.contains(300));
+    REQUIRE_FALSE(list.contains(301));
+    REQUIRE(list.slice(10, 12) == List<U>(values + 10, 2));
+    REQUIRE(list.map<U>([](Size, const U &p_value)
+                        { return p_value / 3; })[500] == 500);
+    REQUIRE_THROWS(list.access());
+
+    const ListView<U> view = list;
+    REQUIRE(view.get_count() == 1000);
+
+    // A header of two elements is skipped, and an odd offset is refused.
+    auto body = MappedList<U>(path, READ_ONLY, 2 * sizeof(U));
+    REQUIRE(body.get_count() == 998);
+    REQUIRE(body[0] == 6);
+    REQUIRE_THROWS(MappedList<U>(path, READ_ONLY, 2));
+    REQUIRE_THROWS(MappedList<U>(path, READ_ONLY, 1001 * sizeof(U)));
+
+    auto moved = move(body);
+    REQUIRE(moved.get_count() == 998);
+    REQUIRE(body.get_count() == 0);
+
+    unlink(path);
+}
+
+TEST_CASE("Mapped list copy on write")
+{
+    U values[] = {1, 2, 3};
+    C path[] = "/tmp/rong_mapped_XXXXXX";
+    write_temporary(path, values, sizeof(values));
+
+    {
+        auto list = MappedList<U>(path, COPY_ON_WRITE);
+        auto writable = list.access();
+        writable[0] = 100;
+        REQUIRE(list[0] == 100);
+    }
+    REQUIRE(MappedList<U>(path)[0] == 1);
+
+    REQUIRE_THROWS(MappedList<U64>(path));
+    REQUIRE_THROWS(MappedList<U>("/tmp/rong_mapped_missing"));
+    unlink(path);
+
+    C empty_path[] = "/tmp/rong_mapped_XXXXXX";
+    write_temporary(empty_path, values, 0);
+    REQUIRE(MappedList<U>(empty_path).get_count() == 0);
+    unlink(empty_path);
+}
\ No newline at end of file
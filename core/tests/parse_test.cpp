@@ -0,0 +1,140 @@
+#include <catch2/catch_test_macros.hpp>
+#include <locale.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <parse.hpp>
+
+using namespace Rong;
+
+static auto view(const C *p_text) -> ListView<C>
+{
+    return ListView<C>(p_text, strlen(p_text));
+}
+
+static auto append_text(List<C> &p_text, const C *p_field, C p_delimiter) -> void
+{
+    for (Size i = 0; p_field[i] != '\0'; i++)
+        p_text.append(p_field[i]);
+    p_text.append(p_delimiter);
+}
+
+TEST_CASE("Parse integers")
+{
+    auto expected = List<I64>();
+    auto text = List<C>();
+    U64 state = 0x9E3779B97F4A7C15;
+    for (Size i = 0; i < 10000; i++)
+    {
+        state = state * 6364136223846793005 + 1442695040888963407;
+        const auto value = static_cast<I64>(state) >> (state % 64);
+        expected.append(value);
+        C field[32];
+        snprintf(field, sizeof(field), "%lld", static_cast<long long>(value));
+        append_text(text, field, '\n');
+    }
+
+    auto values = List<I64>(expected.get_count());
+    const auto result = parse_integers(text, '\n', values);
+    REQUIRE(result.is_success());
+    REQUIRE(result.count == 10000);
+    REQUIRE(values == expected);
+
+    auto limits = List<I64>();
+    REQUIRE(parse_integers(view("9223372036854775807,-9223372036854775808,+7,-000000000000000000000042"), ',', limits).is_success());
+    REQUIRE(limits[0] == 9223372036854775807LL);
+    REQUIRE(limits[1] == -9223372036854775807LL - 1);
+    REQUIRE(limits[2] == 7);
+    REQUIRE(limits[3] == -42);
+
+    auto unsigned_values = List<U64>();
+    REQUIRE(parse_integers(view("18446744073709551615"), ',', unsigned_values).is_success());
+    REQUIRE(unsigned_values[0] == 18446744073709551615ULL);
+    REQUIRE(parse_integers(view("18446744073709551616"), ',', unsigned_values).error_index == 0);
+    REQUIRE(parse_integers(view("-1"), ',', unsigned_values).error_index == 0);
+}
+
+TEST_CASE("Parse integers reports errors")
+{
+    auto values = List<I32>();
+    auto result = parse_integers(view("1,22,3x,4"), ',', values);
+    REQUIRE_FALSE(result.is_success());
+    REQUIRE(result.count == 2);
+    REQUIRE(result.error_index == 6);
+    REQUIRE(values.get_count() == 2);
+
+    values = List<I32>();
+    REQUIRE(parse_integers(view("1,,2"), ',', values).error_index == 2);
+    REQUIRE(parse_integers(view("-"), ',', values).error_index == 1);
+    REQUIRE(parse_integers(view("2147483648"), ',', values).error_index == 0);
+    values = List<I32>();
+    REQUIRE(parse_integers(view("-2147483648,"), ',', values).is_success());
+    REQUIRE(values[0] == -2147483647 - 1);
+    REQUIRE(parse_integers(ListView<C>(), ',', values).count == 0);
+}
+
+TEST_CASE("Parse floats matches strtod")
+{
+    const C *formats[] = {"%.17g", "%.6f", "%.3e", "%.15g", "%g"};
+    auto text = List<C>();
+    auto expected = List<F64>();
+    U64 state = 42;
+    for (Size i = 0; i < 20000; i++)
+    {
+        state = state * 6364136223846793005 + 1442695040888963407;
+        const auto value = static_cast<F64>(static_cast<I64>(state) >> 11) * (i % 2 == 0 ? 1e-9 : 1e-300) * ((state >> 60) + 1);
+        C field[64];
+        snprintf(field, sizeof(field), formats[i % 5], value);
+        expected.append(strtod(field, nullptr));
+        append_text(text, field, ',');
+    }
+
+    auto values = List<F64>();
+    const auto result = parse_floats(text, ',', values);
+    REQUIRE(result.is_success());
+    REQUIRE(values.get_count() == expected.get_count());
+    B identical = true;
+    for (Size i = 0; i < values.get_count(); i++)
+        identical = identical && memcmp(&values[i], &expected[i], sizeof(F64)) == 0;
+    REQUIRE(identical);
+
+    auto special = List<F64>();
+    REQUIRE(parse_floats(view("0.1;-0;.5;5.;1e22;1E-5;0.000001234;123456789012345678901234567890;1e400"), ';', special).is_success());
+    REQUIRE(special[0] == 0.1);
+    REQUIRE(special[1] == 0.0);
+    REQUIRE(__builtin_signbit(special[1]));
+    REQUIRE(special[2] == 0.5);
+    REQUIRE(special[3] == 5.0);
+    REQUIRE(special[4] == 1e22);
+    REQUIRE(special[5] == 1e-5);
+    REQUIRE(special[6] == 0.000001234);
+    REQUIRE(special[7] == 123456789012345678901234567890.0);
+    REQUIRE(special[8] == __builtin_inf());
+}
+
+TEST_CASE("Parse floats reports errors")
+{
+    auto values = List<F64>();
+    auto result = parse_floats(view("1.5\n2.5e\n3"), '\n', values);
+    REQUIRE(result.count == 1);
+    REQUIRE(result.error_index == 8);
+    REQUIRE(parse_floats(view("."), '\n', values).error_index == 1);
+    REQUIRE(parse_floats(view("1.2.3"), '\n', values).error_index == 3);
+    REQUIRE(parse_floats(view("nan"), '\n', values).error_index == 0);
+}
+
+TEST_CASE("Parse floats ignores the numeric locale")
+{
+    const C *comma_locales[] = {"de_DE.UTF-8", "de_DE.utf8", "fr_FR.UTF-8", "fr_FR.utf8"};
+    for (auto name : comma_locales)
+        if (setlocale(LC_NUMERIC, name) != nullptr)
+            break;
+
+    // Both fields miss the fast path: too many digits, and an exponent beyond 22.
+    auto values = List<F64>();
+    const auto result = parse_floats(view("1.2345678901234567;1.5e300"), ';', values);
+    setlocale(LC_NUMERIC, "C");
+    REQUIRE(result.is_success());
+    REQUIRE(values[0] == 1.2345678901234567);
+    REQUIRE(values[1] == 1.5e300);
+}
\ No newline at end of file
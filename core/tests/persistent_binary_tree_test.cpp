@@ -0,0 +1,94 @@
+#include <catch2/catch_test_macros.hpp>
+#include <persistent_binary_tree.hpp>
+
+using namespace Rong;
+
+TEST_CASE("Persistent binary tree base feature")
+{
+    auto tree = PersistentBinaryTree<U, U>();
+    for (U i = 0; i < 1000; i++)
+        tree.set(i, i * 2);
+
+    REQUIRE(tree.get_count() == 1000);
+    REQUIRE(tree.get_height() <= 15);
+    REQUIRE(tree[999] == 1998);
+    REQUIRE_THROWS(tree[1000]);
+
+    U previous = 0;
+    Size visited = 0;
+    tree.for_each([&](const U &p_key, const U &)
+                  {
+                      REQUIRE((visited == 0 || p_key > previous));
+                      previous = p_key;
+                      visited++; });
+    REQUIRE(visited == 1000);
+}
+
+TEST_CASE("Persistent binary tree snapshot")
+{
+    auto tree = PersistentBinaryTree<U, C>();
+    tree.set(1, 'a');
+    tree.set(2, 'b');
+
+    const auto snapshot = tree.snapshot();
+    tree.set(2, 'B');
+    tree.set(3, 'c');
+
+    REQUIRE(snapshot.get_count() == 2);
+    REQUIRE(snapshot[2] == 'b');
+    REQUIRE_FALSE(snapshot.contains(3));
+    REQUIRE(tree.get_count() == 3);
+    REQUIRE(tree[2] == 'B');
+    REQUIRE(tree[3] == 'c');
+}
+
+struct SnapshotReader
+{
+    const PersistentBinaryTree<U, U> *tree;
+    const B *finished;
+};
+
+static auto read_snapshots(void *p_reader) -> void *
+{
+    auto reader = static_cast<SnapshotReader *>(p_reader);
+    while (!__atomic_load_n(reader->finished, __ATOMIC_ACQUIRE))
+    {
+        const auto snapshot = reader->tree->snapshot();
+        U expected = 0;
+        B consistent = true;
+        snapshot.for_each([&](const U &p_key, const U &p_value)
+                          { consistent = consistent && p_key == expected++ && p_value == p_key * 2; });
+        if (!consistent || expected != snapshot.get_count())
+            return p_reader;
+    }
+    return nullptr;
+}
+
+TEST_CASE("Persistent binary tree snapshot while writing")
+{
+    constexpr const U READER_COUNT = 4;
+    auto tree = PersistentBinaryTree<U, U>();
+    B finished = false;
+    pthread_t threads[READER_COUNT];
+    SnapshotReader readers[READER_COUNT];
+    for (U i = 0; i < READER_COUNT; i++)
+    {
+        readers[i] = {&tree, &finished};
+        REQUIRE(pthread_create(threads + i, nullptr, read_snapshots, readers + i) == 0);
+    }
+
+    for (U i = 0; i < 20000; i++)
+        tree.set(i, i * 2);
+    __atomic_store_n(&finished, true, __ATOMIC_RELEASE);
+
+    Size failed = 0;
+    for (U i = 0; i < READER_COUNT; i++)
+    {
+        void *result = nullptr;
+        pthread_join(threads[i], &result);
+        failed += result != nullptr;
+    }
+
+    REQUIRE(failed == 0);
+    REQUIRE(tree.get_count() == 20000);
+}
\ No newline at end of file
@@ -0,0 +1,166 @@
+#include <catch2/catch_test_macros.hpp>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <sys/socket.h>
+#include <reactor.hpp>
+
+using namespace Rong;
+
+static auto add(U p_left, U p_right) -> Task<U>
+{
+    co_return p_left + p_right;
+}
+
+static auto sum(U p_count) -> Task<U>
+{
+    U total = 0;
+    for (U i = 0; i < p_count; i++)
+        total += co_await add(i, 1);
+    co_return total;
+}
+
+TEST_CASE("Task composition")
+{
+    auto reactor = Reactor();
+    REQUIRE(reactor.run(sum(10)) == 55);
+
+    auto task = sum(3);
+    REQUIRE_FALSE(task.is_done());
+    task.start();
+    REQUIRE(task.is_done());
+    REQUIRE(task.take_result() == 6);
+}
+
+static auto transfer(Reactor &p_reactor, I p_read_descriptor, I p_write_descriptor, const List<U8> &p_data) -> Task<List<U8>>
+{
+    // Start the writer without awaiting it, so both ends of the pipe make progress together.
+    auto writer = p_reactor.write(p_write_descriptor, p_data);
+    writer.start();
+
+    auto received = List<U8>();
+    while (received.get_count() < p_data.get_count())
+        if (co_await p_reactor.read(p_read_descriptor, received, 4096) == 0)
+            break;
+
+    REQUIRE(co_await writer == p_data.get_count());
+    co_return received;
+}
+
+TEST_CASE("Reactor pipe transfer")
+{
+    I descriptors[2];
+    REQUIRE(pipe2(descriptors, O_NONBLOCK) == 0);
+
+    auto data = List<U8>();
+    for (U i = 0; i < 200000; i++)
+        data.append(static_cast<U8>(i * 7));
+
+    auto reactor = Reactor();
+    const auto received = reactor.run(transfer(reactor, descriptors[0], descriptors[1], data));
+    REQUIRE(received.get_count() == data.get_count());
+    REQUIRE(received == data);
+
+    close(descriptors[1]);
+    auto remaining = List<U8>();
+    REQUIRE(reactor.run(reactor.read(descriptors[0], remaining, 16)) == 0);
+    close(descriptors[0]);
+}
+
+TEST_CASE("Reactor socket transfer")
+{
+    I descriptors[2];
+    REQUIRE(socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, descriptors) == 0);
+
+    auto data = List<U8>();
+    for (U i = 0; i < 1 << 22; i++)
+        data.append(static_cast<U8>(i * 3));
+
+    auto reactor = Reactor();
+    const auto received = reactor.run(transfer(reactor, descriptors[0], descriptors[1], data));
+    REQUIRE(received == data);
+    close(descriptors[0]);
+    close(descriptors[1]);
+}
+
+TEST_CASE("Reactor refuses blocking descriptors")
+{
+    I descriptors[2];
+    REQUIRE(pipe(descriptors) == 0);
+
+    auto reactor = Reactor();
+    auto buffer = List<U8>();
+    U8 byte = 1;
+    REQUIRE_THROWS(reactor.run(reactor.read(descriptors[0], buffer, 16)));
+    REQUIRE_THROWS(reactor.run(reactor.write(descriptors[1], ListView<U8>(&byte, 1))));
+    REQUIRE((fcntl(descriptors[0], F_GETFL) & O_NONBLOCK) == 0);
+    REQUIRE((fcntl(descriptors[1], F_GETFL) & O_NONBLOCK) == 0);
+    close(descriptors[0]);
+    close(descriptors[1]);
+}
+
+static auto drain(Reactor &p_reactor, I p_descriptor, Size p_count) -> Task<List<U8>>
+{
+    auto received = List<U8>();
+    while (received.get_count() < p_count)
+        if (co_await p_reactor.read(p_descriptor, received, 4096) == 0)
+            break;
+    co_return received;
+}
+
+static auto await_blocked(Reactor &p_reactor, I p_read_descriptor, I p_write_descriptor, const List<U8> &p_data) -> Task<List<U8>>
+{
+    // The writer fills the pipe and parks on the reactor; awaiting it must not resume it a second time.
+    auto writer = p_reactor.write(p_write_descriptor, p_data);
+    writer.start();
+    REQUIRE_FALSE(writer.is_done());
+
+    auto reader = drain(p_reactor, p_read_descriptor, p_data.get_count());
+    reader.start();
+
+    REQUIRE(co_await writer == p_data.get_count());
+    co_return co_await reader;
+}
+
+TEST_CASE("Reactor awaits started task")
+{
+    I descriptors[2];
+    REQUIRE(pipe2(descriptors, O_NONBLOCK) == 0);
+
+    auto data = List<U8>();
+    for (U i = 0; i < 1 << 20; i++)
+        data.append(static_cast<U8>(i * 13));
+
+    auto reactor = Reactor();
+    const auto received = reactor.run(await_blocked(reactor, descriptors[0], descriptors[1], data));
+    REQUIRE(received == data);
+    close(descriptors[0]);
+    close(descriptors[1]);
+}
+
+static auto read_file(Reactor &p_reactor, I p_descriptor) -> Task<List<U8>>
+{
+    auto buffer = List<U8>();
+    co_await p_reactor.read_at(p_descriptor, 6, buffer, 5);
+    co_await p_reactor.read_at(p_descriptor, 0, buffer, 5);
+    const auto tail_count = co_await p_reactor.read_at(p_descriptor, 9, buffer, 100);
+    REQUIRE(tail_count == 2);
+    co_return buffer;
+}
+
+TEST_CASE("Reactor file offload")
+{
+    C path[] = "/tmp/rong_reactor_XXXXXX";
+    const auto descriptor = mkstemp(path);
+    REQUIRE(descriptor >= 0);
+    unlink(path);
+    REQUIRE(::write(descriptor, "hello world", 11) == 11);
+
+    auto reactor = Reactor();
+    const auto buffer = reactor.run(read_file(reactor, descriptor));
+    REQUIRE(buffer == List<U8>(reinterpret_cast<const U8 *>("worldhellold"), 12));
+    close(descriptor);
+
+    auto orphan = List<U8>();
+    REQUIRE_THROWS(reactor.run(reactor.read_at(-1, 0, orphan, 4)));
+    REQUIRE(orphan.get_count() == 0);
+}
\ No newline at end of file
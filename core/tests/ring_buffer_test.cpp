@@ -0,0 +1,86 @@
+#include <catch2/catch_test_macros.hpp>
+#include <pthread.h>
+#include <sched.h>
+#include <ring_buffer.hpp>
+
+using namespace Rong;
+
+TEST_CASE("Ring buffer base feature")
+{
+    REQUIRE_THROWS(RingBuffer<U>(3));
+
+    auto ring = RingBuffer<U>(8);
+    REQUIRE(ring.acquire(4).get_count() == 0);
+
+    auto span = ring.reserve(6);
+    REQUIRE(span.get_count() == 6);
+    for (U i = 0; i < 6; i++)
+        span[i] = i;
+    ring.commit(6);
+    REQUIRE(ring.reserve(6).get_count() == 2);
+
+    auto view = ring.acquire(4);
+    REQUIRE(view.get_count() == 4);
+    REQUIRE(view[3] == 3);
+    ring.release(4);
+
+    // The free space now wraps; only the slots up to the end come back at once.
+    REQUIRE(ring.reserve(6).get_count() == 2);
+    const U values[] = {6, 7, 8, 9, 10, 11, 12};
+    REQUIRE(ring.write(ListView<U>(values, 7)) == 6);
+
+    auto received = List<U>();
+    while (true)
+    {
+        auto part = ring.acquire(100);
+        if (part.get_count() == 0)
+            break;
+        for (Size i = 0; i < part.get_count(); i++)
+            received.append(part[i]);
+        ring.release(part.get_count());
+    }
+    REQUIRE(received.get_count() == 8);
+    for (U i = 0; i < 8; i++)
+        REQUIRE(received[i] == i + 4);
+}
+
+static constexpr const U ELEMENT_COUNT = 100000;
+
+static auto produce(void *p_ring) -> void *
+{
+    auto ring = static_cast<RingBuffer<U> *>(p_ring);
+    for (U sent = 0; sent < ELEMENT_COUNT;)
+    {
+        auto span = ring->reserve(ELEMENT_COUNT - sent < 37 ? ELEMENT_COUNT - sent : 37);
+        for (Size i = 0; i < span.get_count(); i++)
+            span[i] = sent + i;
+        ring->commit(span.get_count());
+        sent += span.get_count();
+        if (span.get_count() == 0)
+            sched_yield();
+    }
+    return nullptr;
+}
+
+TEST_CASE("Ring buffer between threads")
+{
+    auto ring = RingBuffer<U>(64);
+    pthread_t producer;
+    REQUIRE(pthread_create(&producer, nullptr, produce, &ring) == 0);
+
+    U expected = 0;
+    Size misordered = 0;
+    while (expected < ELEMENT_COUNT)
+    {
+        auto view = ring.acquire(50);
+        for (Size i = 0; i < view.get_count(); i++)
+            misordered += view[i] != expected++;
+        ring.release(view.get_count());
+        if (view.get_count() == 0)
+            sched_yield();
+    }
+    pthread_join(producer, nullptr);
+
+    REQUIRE(misordered == 0);
+    REQUIRE(ring.acquire(1).get_count() == 0);
+}
\ No newline at end of file
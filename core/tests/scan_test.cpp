@@ -0,0 +1,69 @@
+#include <catch2/catch_test_macros.hpp>
+#include <scan.hpp>
+
+using namespace Rong;
+
+static auto view(const C *p_text) -> ListView<C>
+{
+    Size count = 0;
+    while (p_text[count] != '\0')
+        count++;
+    return ListView<C>(p_text, count);
+}
+
+TEST_CASE("Scan find byte")
+{
+    auto text = List<C>();
+    for (Size i = 0; i < 200; i++)
+        text.append('a' + i % 3);
+    text[150] = '\n';
+    text[199] = '\n';
+
+    REQUIRE(find_byte(text, '\n') == 150);
+    REQUIRE(find_byte(text, '\n', 150) == 150);
+    REQUIRE(find_byte(text, '\n', 151) == 199);
+    REQUIRE(find_byte(text, 'z') == 200);
+    REQUIRE(find_byte(text, 'a', 200) == 200);
+    REQUIRE(find_byte(ListView<C>(), 'a') == 0);
+
+    // Every position, so each vector width and the scalar tail are hit.
+    for (Size i = 0; i < text.get_count(); i++)
+    {
+        auto probe = List<C>(text);
+        probe[i] = '#';
+        REQUIRE(find_byte(probe, '#') == i);
+    }
+}
+
+TEST_CASE("Scan find any of")
+{
+    const auto text = view("the quick brown fox, jumps; over the lazy dog");
+    REQUIRE(find_any_of(text, view(",;")) == 19);
+    REQUIRE(find_any_of(text, view(",;"), 20) == 26);
+    REQUIRE(find_any_of(text, view("!?")) == text.get_count());
+    REQUIRE(find_any_of(text, view("z")) == 39);
+
+    // Sets past the vector limit go through the lookup table.
+    REQUIRE(find_any_of(text, view("0123456789xyz")) == 18);
+    REQUIRE(find_any_of(text, ListView<C>()) == text.get_count());
+}
+
+TEST_CASE("Scan split")
+{
+    auto fields = split(view("a,,bc,"), ',');
+    REQUIRE(fields.get_count() == 4);
+    REQUIRE(fields[0] == view("a"));
+    REQUIRE(fields[1].get_count() == 0);
+    REQUIRE(fields[2] == view("bc"));
+    REQUIRE(fields[3].get_count() == 0);
+
+    REQUIRE(split(ListView<C>(), ',').get_count() == 1);
+    REQUIRE(split(view("no delimiter here, honest"), '\n')[0] == view("no delimiter here, honest"));
+
+    auto tokens = split(view("key=value;next=pair"), view("=;"));
+    REQUIRE(tokens.get_count() == 4);
+    REQUIRE(tokens[3] == view("pair"));
+
+    const auto source = view("0123456789012345678901234567890123456789,tail");
+    REQUIRE(split(source, ',')[1].view_data() == source.view_data() + 41);
+}
\ No newline at end of file
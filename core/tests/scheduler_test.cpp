@@ -0,0 +1,85 @@
+#include <catch2/catch_test_macros.hpp>
+#include <scheduler.hpp>
+
+using namespace Rong;
+
+TEST_CASE("Work stealing deque")
+{
+    auto deque = WorkStealingDeque<Size>();
+    Size value = 0;
+    REQUIRE_FALSE(deque.pop(value));
+    REQUIRE_FALSE(deque.steal(value));
+
+    for (Size i = 1; i <= 200; i++)
+        deque.push(i);
+    REQUIRE(deque.get_count() == 200);
+
+    REQUIRE(deque.steal(value));
+    REQUIRE(value == 1);
+    REQUIRE(deque.pop(value));
+    REQUIRE(value == 200);
+
+    Size sum = 0;
+    while (deque.pop(value))
+        sum += value;
+    REQUIRE(sum == 200 * 201 / 2 - 201);
+    REQUIRE(deque.get_count() == 0);
+}
+
+static auto fibonacci(TaskGroup &p_parent, Size p_index) -> Size
+{
+    if (p_index < 2)
+        return p_index;
+
+    Size left = 0;
+    auto group = TaskGroup(p_parent.get_scheduler());
+    group.spawn([&]()
+                { left = fibonacci(group, p_index - 1); });
+    const auto right = fibonacci(group, p_index - 2);
+    group.sync();
+    return left + right;
+}
+
+TEST_CASE("Scheduler fork and join")
+{
+    auto scheduler = Scheduler(4);
+    REQUIRE(scheduler.get_worker_count() == 4);
+
+    auto group = TaskGroup(scheduler);
+    REQUIRE(fibonacci(group, 20) == 6765);
+
+    Size counter = 0;
+    for (Size i = 0; i < 1000; i++)
+        group.spawn([&]()
+                    { __atomic_add_fetch(&counter, 1, __ATOMIC_RELAXED); });
+    group.sync();
+    REQUIRE(counter == 1000);
+}
+
+TEST_CASE("Scheduler parallel for")
+{
+    auto scheduler = Scheduler(3);
+    auto values = List<U>();
+    for (U i = 0; i < 100000; i++)
+        values.append(i);
+
+    auto doubled = List<U>(values.get_count());
+    for (U i = 0; i < values.get_count(); i++)
+        doubled.append(0);
+    scheduler.parallel_for(ListView<U>(values.view_data(), values.get_count()), [&](Size p_index, const U &p_value)
+                           { doubled[p_index] = p_value * 2; });
+    Size mismatched = 0;
+    for (U i = 0; i < values.get_count(); i++)
+        mismatched += doubled[i] != i * 2;
+    REQUIRE(mismatched == 0);
+
+    U64 sum = 0;
+    parallel_for(1000, [&](Size p_index)
+                 { __atomic_add_fetch(&sum, p_index, __ATOMIC_RELAXED); });
+    REQUIRE(sum == 999 * 1000 / 2);
+
+    Size visited = 0;
+    scheduler.parallel_for(0, [&](Size)
+                           { visited++; });
+    REQUIRE(visited == 0);
+}
\ No newline at end of file
@@ -0,0 +1,123 @@
+#include <catch2/catch_test_macros.hpp>
+#include <stdlib.h>
+#include <serialization.hpp>
+#include <mapped_list.hpp>
+
+using namespace Rong;
+
+TEST_CASE("Serialization round trip")
+{
+    auto numbers = List<U32>();
+    for (U32 i = 0; i < 1000; i++)
+        numbers.append(i * 7);
+    auto nested = List<List<U8>>();
+    nested.append(List<U8>());
+    nested.append(List<U8>((const U8 *)"abc", 3));
+    auto pairs = List<Pair<U8, U64>>();
+    pairs.append(Pair<U8, U64>(1, 100));
+    pairs.append(Pair<U8, U64>(2, 200));
+
+    auto writer = BinaryWriter();
+    serialize(writer, U8(9));
+    serialize(writer, numbers);
+    serialize(writer, nested);
+    serialize(writer, pairs);
+    serialize(writer, Tuple<U16, F64, C>(5, 2.5, 'x'));
+
+    auto bytes = writer.take();
+    auto reader = BinaryReader(bytes);
+    REQUIRE(reader.get_version() == SERIALIZATION_VERSION);
+
+    U8 small = 0;
+    deserialize(reader, small);
+    REQUIRE(small == 9);
+
+    // Loading reuses the preallocated list.
+    auto loaded = List<U32>(2000);
+    loaded.append(42);
+    const auto storage = loaded.view_data();
+    deserialize(reader, loaded);
+    REQUIRE(loaded == numbers);
+    REQUIRE(loaded.view_data() == storage);
+
+    auto loaded_nested = List<List<U8>>();
+    deserialize(reader, loaded_nested);
+    REQUIRE(loaded_nested.get_count() == 2);
+    REQUIRE(loaded_nested[0].get_count() == 0);
+    REQUIRE(loaded_nested[1] == nested[1]);
+
+    auto loaded_pairs = List<Pair<U8, U64>>();
+    deserialize(reader, loaded_pairs);
+    REQUIRE(contrast(loaded_pairs[1], pairs[1]) == 0);
+
+    auto tuple = Tuple<U16, F64, C>();
+    deserialize(reader, tuple);
+    REQUIRE(tuple.get<0>() == 5);
+    REQUIRE(tuple.get<1>() == 2.5);
+    REQUIRE(tuple.get<2>() == 'x');
+    REQUIRE(reader.is_finished());
+    REQUIRE_THROWS(deserialize(reader, small));
+}
+
+TEST_CASE("Serialization of binary trees")
+{
+    auto tree = BinaryTree<U, U>();
+    for (U i = 0; i < 100; i++)
+        tree.set(i * 40503u % 1000, i);
+
+    auto writer = BinaryWriter();
+    serialize(writer, tree);
+    serialize(writer, BinaryTree<U, U>::LeashType(nullptr));
+
+    auto reader = BinaryReader(writer.view());
+    auto loaded = BinaryTree<U, U>::LeashType(nullptr);
+    deserialize(reader, loaded);
+    REQUIRE(loaded->get_count() == 100);
+    REQUIRE(loaded->get_height() <= 7);
+    for (U i = 0; i < 100; i++)
+        REQUIRE(*loaded->find(i * 40503u % 1000) == i);
+
+    deserialize(reader, loaded);
+    REQUIRE_FALSE(loaded);
+}
+
+TEST_CASE("Serialization rejects malformed streams")
+{
+    const U8 garbage[] = {1, 2, 3, 4, 5, 6, 7, 8};
+    REQUIRE_THROWS(BinaryReader(ListView<U8>(garbage, sizeof(garbage))));
+
+    auto writer = BinaryWriter();
+    serialize(writer, List<U64>(ListView<U64>((const U64 *)"0123456789abcdef", 2)));
+    auto bytes = writer.take();
+    auto truncated = BinaryReader(bytes.slice(0, bytes.get_count() - 1));
+    auto list = List<U64>();
+    REQUIRE_THROWS(deserialize(truncated, list));
+}
+
+TEST_CASE("Serialization zero-copy views over mapped files")
+{
+    auto values = List<U64>();
+    for (U64 i = 0; i < 512; i++)
+        values.append(i * i);
+
+    auto writer = BinaryWriter();
+    serialize(writer, U8(1));
+    serialize(writer, values);
+
+    C path[] = "/tmp/rong_serialization_XXXXXX";
+    const auto descriptor = mkstemp(path);
+    REQUIRE(descriptor >= 0);
+    close(descriptor);
+    writer.save(path);
+
+    auto mapping = MappedList<U8>(path);
+    auto reader = BinaryReader(mapping);
+    U8 flag = 0;
+    deserialize(reader, flag);
+    const auto view = deserialize_view<U64>(reader);
+    REQUIRE(view.get_count() == 512);
+    REQUIRE(view[511] == 511 * 511);
+    REQUIRE(view.view_data() >= (const U64 *)mapping.view_data());
+    REQUIRE(view.view_data() < (const U64 *)(mapping.view_data() + mapping.get_count()));
+    unlink(path);
+}
\ No newline at end of file
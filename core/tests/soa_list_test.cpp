@@ -0,0 +1,125 @@
+#include <catch2/catch_test_macros.hpp>
+#include <soa_list.hpp>
+#include <string.hpp>
+
+using namespace Rong;
+
+TEST_CASE("SoAList base feature")
+{
+    auto list = SoAList<I32, F64, U8>();
+    for (I32 i = 0; i < 100; i++)
+        list.append(i, i * 0.5, static_cast<U8>(i % 3));
+    REQUIRE(list.get_count() == 100);
+    REQUIRE(list.get_capacity() >= 100);
+
+    const auto row = list[42];
+    REQUIRE(row.get<0>() == 42);
+    REQUIRE(row.get<1>() == 21.0);
+    REQUIRE(row.get<2>() == 0);
+    REQUIRE_THROWS(list[100]);
+}
+
+TEST_CASE("SoAList column")
+{
+    auto list = SoAList<I32, F64>();
+    for (I32 i = 1; i <= 10; i++)
+        list.append(i, 0.0);
+
+    const auto ids = list.column<0>();
+    REQUIRE(ids.get_count() == 10);
+    I32 sum = 0;
+    for (Size i = 0; i < ids.get_count(); i++)
+        sum += ids[i];
+    REQUIRE(sum == 55);
+    REQUIRE(&ids[1] == &ids[0] + 1);
+
+    auto weights = list.access_column<1>();
+    for (Size i = 0; i < weights.get_count(); i++)
+        weights[i] = 2.0;
+    REQUIRE(list[9].get<1>() == 2.0);
+}
+
+TEST_CASE("SoAList row iteration")
+{
+    auto list = SoAList<I32, I32>();
+    for (I32 i = 0; i < 5; i++)
+        list.append(i, i * i);
+
+    for (auto row : list)
+        row.get<1>() += row.get<0>();
+    REQUIRE(list[3].get<1>() == 12);
+
+    I32 total = 0;
+    list.for_each([&](Size p_index, auto p_row)
+                  { total += p_row.template get<1>() - static_cast<I32>(p_index); });
+    REQUIRE(total == 30);
+}
+
+TEST_CASE("SoAList remove")
+{
+    auto list = SoAList<I32, String>();
+    for (I32 i = 0; i < 20; i++)
+        list.append(i, String("a row holding a string long enough for the heap"));
+    list[7].get<1>().append('!');
+
+    const auto removed = list.remove(7);
+    REQUIRE(removed.get<0>() == 7);
+    REQUIRE(removed.get<1>().ends_with("heap!"));
+    REQUIRE(list.get_count() == 19);
+    REQUIRE(list[7].get<0>() == 8);
+    REQUIRE(list.column<1>().get_count() == 19);
+    REQUIRE(list[18].get<0>() == 19);
+    REQUIRE_THROWS(list.remove(19));
+}
+
+TEST_CASE("SoAList copy and move")
+{
+    auto list = SoAList<I32, String>();
+    for (I32 i = 0; i < 3; i++)
+        list.append(i, String("value"));
+
+    auto copied = list;
+    copied[0].get<1>().append('s');
+    REQUIRE(list[0].get<1>() == StringView("value"));
+    REQUIRE(copied[0].get<1>() == StringView("values"));
+
+    auto moved = move(copied);
+    REQUIRE(moved.get_count() == 3);
+    REQUIRE(copied.get_count() == 0);
+
+    list = moved;
+    REQUIRE(list[0].get<1>() == StringView("values"));
+    moved.clean();
+    REQUIRE(moved.get_count() == 0);
+}
+
+
+template <class T>
+struct CountingAllocator : Inconstructible
+{
+    static inline I64 balance = 0;
+    static auto allocate(Size p_count = 1) -> T *
+    {
+        balance++;
+        return Allocator<T>::allocate(p_count);
+    }
+    static auto deallocate(T *p_pointer) -> void
+    {
+        balance--;
+        Allocator<T>::deallocate(p_pointer);
+    }
+};
+
+TEST_CASE("SoAList allocator")
+{
+    {
+        auto list = AllocatedSoAList<CountingAllocator, I32, F64>();
+        for (I32 i = 0; i < 100; i++)
+            list.append(i, i * 0.5);
+        REQUIRE(CountingAllocator<I32>::balance == 1);
+        REQUIRE(CountingAllocator<F64>::balance == 1);
+        REQUIRE(list.column<1>()[99] == 49.5);
+    }
+    REQUIRE(CountingAllocator<I32>::balance == 0);
+    REQUIRE(CountingAllocator<F64>::balance == 0);
+}
\ No newline at end of file
@@ -0,0 +1,148 @@
+#include <catch2/catch_test_macros.hpp>
+#include <string.hpp>
+#include <hash_map.hpp>
+
+using namespace Rong;
+
+TEST_CASE("String small string optimization")
+{
+    REQUIRE(sizeof(String) == 24);
+
+    auto empty = String();
+    REQUIRE(empty.get_count() == 0);
+    REQUIRE(empty.get_capacity() == String::INLINE_CAPACITY);
+
+    auto text = String("exactly twenty-three ch");
+    REQUIRE(text.get_count() == 23);
+    REQUIRE(text.get_capacity() == String::INLINE_CAPACITY);
+    REQUIRE(text.view_data() == reinterpret_cast<const C *>(&text));
+
+    text.append('!');
+    REQUIRE(text.get_count() == 24);
+    REQUIRE(text.get_capacity() >= 24);
+    REQUIRE(text == "exactly twenty-three ch!");
+
+    // Appending a string to itself survives the reallocation.
+    text.append(text);
+    REQUIRE(text == "exactly twenty-three ch!exactly twenty-three ch!");
+
+    auto moved = move(text);
+    REQUIRE(text.get_count() == 0);
+    REQUIRE(moved.get_count() == 48);
+    auto copied = moved;
+    REQUIRE(copied == moved.view());
+    copied[0] = 'E';
+    REQUIRE(copied.starts_with("Exactly"));
+    REQUIRE(moved.starts_with("exactly"));
+
+    copied = String("short");
+    REQUIRE(copied == "short");
+    copied.clean();
+    REQUIRE(copied.get_count() == 0);
+    REQUIRE_THROWS(copied[0]);
+
+    // Zeroed memory, as handed out by `Allocator`, is an empty string.
+    auto zeroed = Allocator<String>::allocate(2);
+    zeroed[1] = String("a long string that lives on the heap");
+    REQUIRE(zeroed[0].get_count() == 0);
+    REQUIRE(zeroed[1].ends_with("heap"));
+    zeroed[1].~String();
+    Allocator<String>::deallocate(zeroed);
+}
+
+TEST_CASE("String search")
+{
+    const auto haystack = String("the quick brown fox jumps over the lazy dog, then the quick cat naps");
+    REQUIRE(haystack.find("quick") == 4);
+    REQUIRE(haystack.find("quick", 5) == 54);
+    REQUIRE(haystack.find("naps") == haystack.get_count() - 4);
+    REQUIRE(haystack.find("quack") == haystack.get_count());
+    REQUIRE(haystack.find('z') == 37);
+    REQUIRE(haystack.find("") == 0);
+    REQUIRE(haystack.contains("lazy dog"));
+    REQUIRE_FALSE(haystack.contains("lazy cat"));
+    REQUIRE(haystack.starts_with(""));
+    REQUIRE(haystack.ends_with("cat naps"));
+    REQUIRE(haystack.slice(4, 9) == "quick");
+    REQUIRE(haystack.slice(haystack.get_count(), haystack.get_count()).get_count() == 0);
+    REQUIRE_THROWS(haystack.slice(3, 2));
+
+    // Compare against a brute-force search at every offset and needle length.
+    auto text = String();
+    for (Size i = 0; i < 200; i++)
+        text.append('a' + i * i % 5);
+    for (Size length = 1; length < 12; length++)
+        for (Size begin = 0; begin + length <= text.get_count(); begin += 7)
+        {
+            const auto needle = text.slice(begin, begin + length);
+            Size expected = 0;
+            while (!(text.slice(expected, expected + length) == needle))
+                expected++;
+            REQUIRE(text.find(needle) == expected);
+        }
+}
+
+TEST_CASE("String concatenation, contrast and hashing")
+{
+    const auto first = String("alpha");
+    const auto joined = string_concat(first, ", ", StringView("beta"), String(" and a rather long gamma"));
+    REQUIRE(joined == "alpha, beta and a rather long gamma");
+    REQUIRE(joined.get_capacity() == joined.get_count());
+    REQUIRE(first.concat("bet") == "alphabet");
+
+    REQUIRE(contrast(String("abc"), String("abd")) < 0);
+    REQUIRE(contrast(String("abc"), StringView("ab")) > 0);
+    REQUIRE(contrast(StringView("ab"), String("ab")) == 0);
+    REQUIRE(contrast(StringView(), StringView("")) == 0);
+
+    const auto list = List<C>("hello", 5);
+    const StringView view = ListView<C>(list);
+    REQUIRE(hash(String(view)) == hash(list));
+    const ListView<C> back = String("hello");
+    REQUIRE(back.get_count() == 5);
+
+    auto map = HashMap<String, U>();
+    for (U i = 0; i < 100; i++)
+    {
+        auto key = String("key-");
+        key.append('0' + i / 10);
+        key.append('0' + i % 10);
+        map.set(key, i);
+    }
+    REQUIRE(map.get_count() == 100);
+    REQUIRE(*map.find("key-42") == 42);
+    REQUIRE(map.find("key-100") == nullptr);
+}
+
+template <class T>
+struct CountingAllocator : Inconstructible
+{
+    static inline I64 balance = 0;
+    static auto allocate(Size p_count = 1) -> T *
+    {
+        balance++;
+        return Allocator<T>::allocate(p_count);
+    }
+    static auto deallocate(T *p_pointer) -> void
+    {
+        balance--;
+        Allocator<T>::deallocate(p_pointer);
+    }
+};
+
+TEST_CASE("String allocator")
+{
+    using CountedString = AllocatedString<CountingAllocator>;
+    {
+        auto text = CountedString("short");
+        REQUIRE(CountingAllocator<C>::balance == 0);
+        text.append(StringView(" enough to leave the inline buffer"));
+        REQUIRE(CountingAllocator<C>::balance == 1);
+
+        const auto copied = text;
+        REQUIRE(CountingAllocator<C>::balance == 2);
+        REQUIRE(contrast(copied, text) == 0);
+        REQUIRE(hash(copied) == hash(String(text.view())));
+    }
+    REQUIRE(CountingAllocator<C>::balance == 0);
+}
\ No newline at end of file
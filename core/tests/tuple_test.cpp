@@ -1,4 +1,5 @@
 #include <catch2/catch_test_macros.hpp>
+#include <pair.hpp>
 #include <tuple.hpp>
 
 using namespace Rong;
@@ -10,3 +11,39 @@ TEST_CASE("Tuple base feature")
     REQUIRE(tuple.get<1>() == 2);
     REQUIRE(tuple.get<2>() == 3);
 }
+
+TEST_CASE("Tuple layout")
+{
+    REQUIRE(sizeof(Tuple<C, U64, C, U64>) == 24);
+    REQUIRE(sizeof(Tuple<U8, U32, U16, U8>) == 8);
+
+    const auto tuple = Tuple<C, U64, C, U64>('a', 1, 'b', 2);
+    REQUIRE(tuple.get<0>() == 'a');
+    REQUIRE(tuple.get<1>() == 1);
+    REQUIRE(tuple.get<2>() == 'b');
+    REQUIRE(tuple.get<3>() == 2);
+    REQUIRE(tuple.get<U64>() == 1);
+}
+
+TEST_CASE("Tuple reference access")
+{
+    auto tuple = Tuple<I32, F64>(1, 2.5);
+    tuple.get<0>() += 41;
+    REQUIRE(tuple.get<0>() == 42);
+    REQUIRE(&tuple.get<1>() == &tuple.get<1>());
+
+    auto value = 7;
+    auto references = Tuple<I32 &, C>(value, 'x');
+    references.get<0>() = 8;
+    REQUIRE(value == 8);
+    REQUIRE(Tuple<I32 &, C>(value, 'y').get<0>() == 8);
+}
+
+TEST_CASE("Pair and Tuple hash and contrast")
+{
+    REQUIRE(hash(Pair<U, U>(1, 2)) != hash(Pair<U, U>(2, 1)));
+    REQUIRE(hash(Tuple<U, C, U>(1, 'a', 2)) == hash(Tuple<U, C, U>(1, 'a', 2)));
+    REQUIRE(hash(Tuple<U, C, U>(1, 'a', 2)) != hash(Tuple<U, C, U>(2, 'a', 1)));
+    REQUIRE(contrast(Tuple<U, C>(1, 'b'), Tuple<U, C>(1, 'a')) > 0);
+    REQUIRE(contrast(Pair<U, U>(0, 9), Pair<U, U>(1, 0)) < 0);
+}
\ No newline at end of file